@@ -5,21 +5,159 @@
  * File Name: Det.c
  *
  * Description:  Det stores the development errors reported by other modules.
+ *               The errors are kept in a ring buffer: Det_ReportError adds them and may run
+ *               in any ISR, Det_GetError drains them from a background task. Each side claims
+ *               or frees its entry inside a short DET_ENTER_CRITICAL section, so reports from
+ *               contexts that preempt each other never share an entry or lose a count.
  *
  * Author: Ammar Moataz
  ******************************************************************************/
 
 #include "Det.h"
 
+/* Index of a ring buffer entry, the indexes run freely and are masked on access */
+#define DET_BUFFER_INDEX(INDEX)       ((INDEX) & (DET_BUFFER_SIZE - 1U))
+
+/* Recorded errors, entries from Det_Tail up to Det_Head are not drained yet */
+STATIC Det_ErrorType Det_Buffer[DET_BUFFER_SIZE];
+STATIC uint16 Det_Head = 0;
+STATIC uint16 Det_Tail = 0;
+
+/* Reports dropped because the buffer was full */
+STATIC uint16 Det_LostCount = 0;
+
+/************************************************************************************
+ * Service Name: Det_ReportError
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ModuleId - Module ID of calling module.
+ *                  InstanceId - The identifier of the index based instance of a module.
+ *                  ApiId - ID of API service in which error is detected.
+ *                  ErrorId - ID of detected development error.
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType - always E_OK
+ * Description: Records a development error. A report identical to the newest entry not
+ *              drained yet only increments its count, so error storms do not flood the
+ *              buffer. When the buffer is full the report is counted as lost.
+ ************************************************************************************/
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                       uint8 InstanceId,
                       uint8 ApiId,
                       uint8 ErrorId )
 {
+    uint32 timestamp = (uint32)DET_GET_TIMESTAMP();
+    uint32 state;
+    uint16 head;
+    uint16 used;
+    Det_ErrorType *newest;
+
+    /* The entry is looked up, claimed or counted without being preempted by another report or the drain */
+    DET_ENTER_CRITICAL(state);
+    head = Det_Head;
+    used = (uint16)(head - Det_Tail);
+    newest = &Det_Buffer[DET_BUFFER_INDEX((uint16)(head - 1U))];
+
+    if ((used != 0) && (newest->moduleId == ModuleId) && (newest->instanceId == InstanceId)
+        && (newest->apiId == ApiId) && (newest->errorId == ErrorId))
+    {
+        /* Same error again, count it */
+        if (newest->count < DET_COUNTER_MAX)
+        {
+            newest->count++;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else if (used < DET_BUFFER_SIZE)
+    {
+        Det_ErrorType *entry = &Det_Buffer[DET_BUFFER_INDEX(head)];
+
+        entry->moduleId = ModuleId;
+        entry->instanceId = InstanceId;
+        entry->apiId = ApiId;
+        entry->errorId = ErrorId;
+        entry->count = 1U;
+        entry->timestamp = timestamp;
+        Det_Head = (uint16)(head + 1U);
+    }
+    else
+    {
+        if (Det_LostCount < DET_COUNTER_MAX)
+        {
+            Det_LostCount++;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    DET_EXIT_CRITICAL(state);
+
+#if (DET_HALT_ON_ERROR == STD_ON)
     while(1)
     {
 
     }
+#endif
+
     return E_OK;
 }
 
+/************************************************************************************
+ * Service Name: Det_GetError
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): Error - Copy of the oldest recorded error
+ * Return value: Std_ReturnType - E_OK if an error was drained, E_NOT_OK if the buffer is empty
+ * Description: Removes the oldest recorded error from the error ring buffer.
+ ************************************************************************************/
+Std_ReturnType Det_GetError(Det_ErrorType *Error)
+{
+    Std_ReturnType result = E_NOT_OK;
+    uint32 state;
+
+    if (NULL_PTR == Error)
+    {
+        return E_NOT_OK;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* A repeat reported while the entry is copied is either in the copy or in a new entry */
+    DET_ENTER_CRITICAL(state);
+    if (Det_Tail != Det_Head)
+    {
+        *Error = Det_Buffer[DET_BUFFER_INDEX(Det_Tail)];
+        Det_Tail = (uint16)(Det_Tail + 1U);
+        result = E_OK;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    DET_EXIT_CRITICAL(state);
+
+    return result;
+}
+
+/************************************************************************************
+ * Service Name: Det_GetLostCount
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: uint16 - Number of lost reports, saturated at DET_COUNTER_MAX
+ * Description: Returns the number of reports dropped because the error ring buffer was full.
+ ************************************************************************************/
+uint16 Det_GetLostCount(void)
+{
+    return Det_LostCount;
+}
@@ -45,12 +45,78 @@
   #error "The AR version of Std_Types.h does not match the expected version"
 #endif
 
+/*******************************************************************************
+ *                      Pre-Compile Configuration                              *
+ *******************************************************************************/
+/* Number of entries of the error ring buffer, must be a power of two */
+#ifndef DET_BUFFER_SIZE
+#define DET_BUFFER_SIZE               (16U)
+#endif
+
+/* Pre-compile option to halt after recording an error, as bench builds expect */
+#ifndef DET_HALT_ON_ERROR
+#define DET_HALT_ON_ERROR             (STD_OFF)
+#endif
+
+/* Timestamp recorded with each error, e.g. a free running timer or the DWT cycle counter */
+#ifndef DET_GET_TIMESTAMP
+#define DET_GET_TIMESTAMP()           (0U)
+#endif
+
+/* Critical section around the updates of the error ring buffer, so that reports from an ISR and from
+ * the code it preempts do not claim the same entry. The previous PRIMASK is saved and restored, so the
+ * section can be entered with interrupts already masked. Hosts have no interrupts to mask */
+#ifndef DET_ENTER_CRITICAL
+#if defined(__GNUC__) && defined(__arm__)
+#define DET_ENTER_CRITICAL(STATE)     __asm volatile ("mrs %0, primask\n\tcpsid i" : "=r" (STATE) : : "memory")
+#define DET_EXIT_CRITICAL(STATE)      __asm volatile ("msr primask, %0" : : "r" (STATE) : "memory")
+#elif defined(__arm__) || defined(__ICCARM__) || defined(__TI_ARM__)
+  #error "DET_ENTER_CRITICAL and DET_EXIT_CRITICAL must be defined for this compiler"
+#else
+#define DET_ENTER_CRITICAL(STATE)     ((STATE) = 0U)
+#define DET_EXIT_CRITICAL(STATE)      ((void)(STATE))
+#endif
+#endif
+
+#if ((DET_BUFFER_SIZE & (DET_BUFFER_SIZE - 1U)) != 0)
+  #error "DET_BUFFER_SIZE must be a power of two"
+#endif
+
+/* Saturation value of the repeat and lost counters */
+#define DET_COUNTER_MAX               (0xFFFFU)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: One development error recorded by Det_ReportError.
+ *	1. The reporting module, instance, API and error IDs.
+ *	2. The number of identical consecutive reports folded into this entry.
+ *	3. The timestamp of the first report.
+ */
+typedef struct
+{
+  uint16 moduleId;
+  uint8 instanceId;
+  uint8 apiId;
+  uint8 errorId;
+  uint16 count;
+  uint32 timestamp;
+} Det_ErrorType;
+
 /*******************************************************************************
  *                      Function Prototypes                                    *
  *******************************************************************************/
+/* Records a development error in the error ring buffer */
 Std_ReturnType Det_ReportError( uint16 ModuleId,
                                 uint8 InstanceId,
                                 uint8 ApiId,
-		                uint8 ErrorId );
+                                uint8 ErrorId );
+
+/* Removes the oldest recorded error from the error ring buffer */
+Std_ReturnType Det_GetError(Det_ErrorType *Error);
+
+/* Returns the number of reports dropped because the error ring buffer was full */
+uint16 Det_GetLostCount(void);
 
 #endif /* DET_H */
@@ -0,0 +1,224 @@
+/******************************************************************************
+ *
+ * Module: Dio
+ *
+ * File Name: Dio.c
+ *
+ * Description: Source file for TM4C123GH6PM Microcontroller - Dio Driver.
+ *              Every access goes through the address masked aliases of the GPIO data register,
+ *              so it touches only the selected pins without a read-modify-write and cannot
+ *              corrupt the other pins of the port written from an interrupt. The accesses use
+ *              the raw register macros, so they stay out of the Port Driver register trace.
+ *
+ * Author: Ammar Moataz
+ ******************************************************************************/
+
+#include "Dio.h"
+#include "Port_Regs.h"
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+
+#include "Det.h"
+/* AUTOSAR Version checking between Det and Dio Modules */
+#if ((DET_AR_MAJOR_VERSION != DIO_AR_RELEASE_MAJOR_VERSION) || (DET_AR_MINOR_VERSION != DIO_AR_RELEASE_MINOR_VERSION) || (DET_AR_PATCH_VERSION != DIO_AR_RELEASE_PATCH_VERSION))
+#error "The AR version of Det.h does not match the expected version"
+#endif
+
+#endif
+
+/* Data register alias of each channel that selects only its pin, indexed by the channel ID */
+STATIC const uint32 Dio_ChannelAddress[DIO_NUMBER_OF_CHANNELS] = {
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 1U << 0),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 1U << 1),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 1U << 2),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 1U << 3),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 1U << 4),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 1U << 5),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 1U << 6),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTA_BASE_ADDRESS, 1U << 7),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 1U << 0),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 1U << 1),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 1U << 2),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 1U << 3),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 1U << 4),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 1U << 5),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 1U << 6),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTB_BASE_ADDRESS, 1U << 7),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 1U << 0),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 1U << 1),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 1U << 2),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 1U << 3),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 1U << 4),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 1U << 5),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 1U << 6),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTC_BASE_ADDRESS, 1U << 7),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 1U << 0),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 1U << 1),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 1U << 2),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 1U << 3),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 1U << 4),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 1U << 5),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 1U << 6),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTD_BASE_ADDRESS, 1U << 7),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 1U << 0),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 1U << 1),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 1U << 2),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 1U << 3),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 1U << 4),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTE_BASE_ADDRESS, 1U << 5),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 1U << 0),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 1U << 1),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 1U << 2),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 1U << 3),
+    PORT_DATA_MASKED_ADDRESS(GPIO_PORTF_BASE_ADDRESS, 1U << 4)};
+
+/* GPIO Registers base address of each port, indexed by the port number */
+STATIC const uint32 Dio_BaseAddress[PORT_NUMBER_OF_PORTS] = {
+    GPIO_PORTA_BASE_ADDRESS,
+    GPIO_PORTB_BASE_ADDRESS,
+    GPIO_PORTC_BASE_ADDRESS,
+    GPIO_PORTD_BASE_ADDRESS,
+    GPIO_PORTE_BASE_ADDRESS,
+    GPIO_PORTF_BASE_ADDRESS};
+
+/************************************************************************************
+ * Service Name: Dio_ReadChannel
+ * Service ID[hex]: 0x00
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ChannelId - ID of DIO channel.
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Dio_LevelType - STD_HIGH or STD_LOW, the level of the channel.
+ * Description: Returns the level of a channel with a single load of its data register alias.
+ ************************************************************************************/
+Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId)
+{
+    /************************************************ DET Errors Check ****************************************/
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Invalid channel ID DET error */
+    if (ChannelId >= DIO_NUMBER_OF_CHANNELS)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_READ_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        return STD_LOW;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+
+    /* The alias reads 0 for all the pins except the channel pin */
+    return (PORT_RAW_READ_REG(Dio_ChannelAddress[ChannelId]) != 0) ? STD_HIGH : STD_LOW;
+}
+
+/************************************************************************************
+ * Service Name: Dio_WriteChannel
+ * Service ID[hex]: 0x01
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ChannelId - ID of DIO channel.
+ *                  Level - Value to be written.
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the level of a channel with a single store to its data register alias.
+ ************************************************************************************/
+void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level)
+{
+    /************************************************ DET Errors Check ****************************************/
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Invalid channel ID DET error */
+    if (ChannelId >= DIO_NUMBER_OF_CHANNELS)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        return;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+
+    /* The alias ignores the written bits of all the pins except the channel pin */
+    PORT_RAW_WRITE_REG(Dio_ChannelAddress[ChannelId], (Level == STD_LOW) ? 0x00U : 0xFFU);
+}
+
+/************************************************************************************
+ * Service Name: Dio_WriteChannelGroup
+ * Service ID[hex]: 0x05
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ChannelGroupIdPtr - Pointer to ChannelGroup.
+ *                  Level - Value to be written, right aligned.
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the levels of all the channels of a group with a single store to the
+ *              data register alias selecting the group pins.
+ ************************************************************************************/
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr, Dio_PortLevelType Level)
+{
+    /************************************************ DET Errors Check ****************************************/
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Null group pointer DET error */
+    if (NULL_PTR == ChannelGroupIdPtr)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_POINTER);
+        return;
+    }
+    /* Invalid group DET error */
+    else if ((ChannelGroupIdPtr->port >= PORT_NUMBER_OF_PORTS) || (ChannelGroupIdPtr->offset > 7U) || (ChannelGroupIdPtr->mask == 0))
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_WRITE_CHANNEL_GROUP_SID, DIO_E_PARAM_INVALID_GROUP);
+        return;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+
+    PORT_RAW_WRITE_REG(PORT_DATA_MASKED_ADDRESS(Dio_BaseAddress[ChannelGroupIdPtr->port], ChannelGroupIdPtr->mask),
+                   (uint32)Level << ChannelGroupIdPtr->offset);
+}
+
+/************************************************************************************
+ * Service Name: Dio_FlipChannel
+ * Service ID[hex]: 0x11
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): ChannelId - ID of DIO channel.
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Dio_LevelType - STD_HIGH or STD_LOW, the level of the channel after the flip.
+ * Description: Inverts the level of a channel with one load and one store of its data register
+ *              alias, the other pins of the port are never written.
+ ************************************************************************************/
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId)
+{
+    uint32 address;
+    uint32 level;
+
+    /************************************************ DET Errors Check ****************************************/
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Invalid channel ID DET error */
+    if (ChannelId >= DIO_NUMBER_OF_CHANNELS)
+    {
+        Det_ReportError(DIO_MODULE_ID, DIO_INSTANCE_ID, DIO_FLIP_CHANNEL_SID, DIO_E_PARAM_INVALID_CHANNEL_ID);
+        return STD_LOW;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+
+    address = Dio_ChannelAddress[ChannelId];
+    level = PORT_RAW_READ_REG(address);
+    PORT_RAW_WRITE_REG(address, ~level);
+
+    return (level != 0) ? STD_LOW : STD_HIGH;
+}
+#endif
@@ -0,0 +1,139 @@
+/******************************************************************************
+ *
+ * Module: Dio
+ *
+ * File Name: Dio.h
+ *
+ * Description: Header file for TM4C123GH6PM Microcontroller - Dio Driver.
+ *
+ * Author: Ammar Moataz
+ ******************************************************************************/
+
+#ifndef DIO_H
+#define DIO_H
+
+/* Id for the company in the AUTOSAR */
+#define DIO_VENDOR_ID (1000U)
+
+/* Dio Module Id */
+#define DIO_MODULE_ID (120U)
+
+/* Dio Instance Id */
+#define DIO_INSTANCE_ID (0U)
+
+/*
+ * Module Version 1.0.0
+ */
+#define DIO_SW_MAJOR_VERSION (1U)
+#define DIO_SW_MINOR_VERSION (0U)
+#define DIO_SW_PATCH_VERSION (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define DIO_AR_RELEASE_MAJOR_VERSION (4U)
+#define DIO_AR_RELEASE_MINOR_VERSION (0U)
+#define DIO_AR_RELEASE_PATCH_VERSION (3U)
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* AUTOSAR checking between Std Types and Dio Modules */
+#if ((STD_TYPES_AR_RELEASE_MAJOR_VERSION != DIO_AR_RELEASE_MAJOR_VERSION) || (STD_TYPES_AR_RELEASE_MINOR_VERSION != DIO_AR_RELEASE_MINOR_VERSION) || (STD_TYPES_AR_RELEASE_PATCH_VERSION != DIO_AR_RELEASE_PATCH_VERSION))
+#error "The AR version of Std_Types.h does not match the expected version"
+#endif
+
+/* The Dio channels are the Pin IDs of the Port Driver */
+#include "Port.h"
+
+/* AUTOSAR Version checking between Port and Dio Modules */
+#if ((PORT_AR_RELEASE_MAJOR_VERSION != DIO_AR_RELEASE_MAJOR_VERSION) || (PORT_AR_RELEASE_MINOR_VERSION != DIO_AR_RELEASE_MINOR_VERSION) || (PORT_AR_RELEASE_PATCH_VERSION != DIO_AR_RELEASE_PATCH_VERSION))
+#error "The AR version of Port.h does not match the expected version"
+#endif
+
+/* Dio Pre-Compile Configuration Header file */
+#include "Dio_Cfg.h"
+
+/* AUTOSAR Version checking between Dio_Cfg.h and Dio.h files */
+#if ((DIO_CFG_AR_RELEASE_MAJOR_VERSION != DIO_AR_RELEASE_MAJOR_VERSION) || (DIO_CFG_AR_RELEASE_MINOR_VERSION != DIO_AR_RELEASE_MINOR_VERSION) || (DIO_CFG_AR_RELEASE_PATCH_VERSION != DIO_AR_RELEASE_PATCH_VERSION))
+#error "The AR version of Dio_Cfg.h does not match the expected version"
+#endif
+
+/* Software Version checking between Dio_Cfg.h and Dio.h files */
+#if ((DIO_CFG_SW_MAJOR_VERSION != DIO_SW_MAJOR_VERSION) || (DIO_CFG_SW_MINOR_VERSION != DIO_SW_MINOR_VERSION) || (DIO_CFG_SW_PATCH_VERSION != DIO_SW_PATCH_VERSION))
+#error "The SW version of Dio_Cfg.h does not match the expected version"
+#endif
+
+/******************************************************************************
+ *                      API Service Id Macros                                 *
+ ******************************************************************************/
+/* Service ID for Dio Read Channel */
+#define DIO_READ_CHANNEL_SID (uint8)0x00
+
+/* Service ID for Dio Write Channel */
+#define DIO_WRITE_CHANNEL_SID (uint8)0x01
+
+/* Service ID for Dio Write Channel Group */
+#define DIO_WRITE_CHANNEL_GROUP_SID (uint8)0x05
+
+/* Service ID for Dio Flip Channel */
+#define DIO_FLIP_CHANNEL_SID (uint8)0x11
+
+/*******************************************************************************
+ *                      DET Error Codes                                        *
+ *******************************************************************************/
+/* DET code to report Invalid Channel ID requested */
+#define DIO_E_PARAM_INVALID_CHANNEL_ID (uint8)0x0A
+
+/* DET code to report Invalid Channel Group requested */
+#define DIO_E_PARAM_INVALID_GROUP (uint8)0x1F
+
+/* DET code to report APIs called with a Null Pointer */
+#define DIO_E_PARAM_POINTER (uint8)0x20
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Type definition for Dio_ChannelType used by the DIO APIs, the channels are the Port Pin IDs (PA0 ... PF4) */
+typedef Port_PinType Dio_ChannelType;
+
+/* Type definition for Dio_PortType used by the DIO APIs (PORT_PortA ... PORT_PortF) */
+typedef uint8 Dio_PortType;
+
+/* Type definition for Dio_LevelType used by the DIO APIs (STD_LOW or STD_HIGH) */
+typedef uint8 Dio_LevelType;
+
+/* Type definition for Dio_PortLevelType used by the DIO APIs */
+typedef uint8 Dio_PortLevelType;
+
+/* Description: Adjacent channels of one port accessed together.
+ *	1. The bits of the channels in the port.
+ *	2. The number of the first channel bit in the port.
+ *	3. The port of the channels.
+ */
+typedef struct
+{
+  uint8 mask;
+  uint8 offset;
+  Dio_PortType port;
+} Dio_ChannelGroupType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+/* Returns the level of a channel with a single load */
+Dio_LevelType Dio_ReadChannel(Dio_ChannelType ChannelId);
+
+/* Sets the level of a channel with a single store */
+void Dio_WriteChannel(Dio_ChannelType ChannelId, Dio_LevelType Level);
+
+/* Sets the levels of a channel group with a single store */
+void Dio_WriteChannelGroup(const Dio_ChannelGroupType *ChannelGroupIdPtr, Dio_PortLevelType Level);
+
+/* Inverts the level of a channel */
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+Dio_LevelType Dio_FlipChannel(Dio_ChannelType ChannelId);
+#endif
+
+#endif /* DIO_H */
@@ -0,0 +1,38 @@
+/******************************************************************************
+ *
+ * Module: Dio
+ *
+ * File Name: Dio_Cfg.h
+ *
+ * Description: Pre-Compile Configuration Header file for TM4C123GH6PM Microcontroller - Dio Driver
+ *
+ * Author: Ammar Moataz
+ ******************************************************************************/
+
+#ifndef DIO_CFG_H
+#define DIO_CFG_H
+
+/*
+ * Module Version 1.0.0
+ */
+#define DIO_CFG_SW_MAJOR_VERSION (1U)
+#define DIO_CFG_SW_MINOR_VERSION (0U)
+#define DIO_CFG_SW_PATCH_VERSION (0U)
+
+/*
+ * AUTOSAR Version 4.0.3
+ */
+#define DIO_CFG_AR_RELEASE_MAJOR_VERSION (4U)
+#define DIO_CFG_AR_RELEASE_MINOR_VERSION (0U)
+#define DIO_CFG_AR_RELEASE_PATCH_VERSION (3U)
+
+/* Pre-compile option for Development Error Detect */
+#define DIO_DEV_ERROR_DETECT (STD_ON)
+
+/* Pre-compile option for Flip Channel API */
+#define DIO_FLIP_CHANNEL_API (STD_ON)
+
+/* Number of Dio channels, one per MCU pin */
+#define DIO_NUMBER_OF_CHANNELS (PORT_NUMBER_OF_PINS)
+
+#endif /* DIO_CFG_H */
@@ -11,6 +11,8 @@
 
 #include "Port.h"
 #include "Port_Regs.h"
+#include "Port_Trace.h"
+#include "Port_Image.h"
 
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
 
@@ -22,433 +24,2706 @@
 
 #endif
 
+/* The packed pin configuration keeps the pin mode in a 4-bit field */
+#if (PORT_NUMBER_OF_PIN_MODES > (PORT_CONFIG_MODE_MASK + 1U))
+#error "The pin modes do not fit in the mode field of Port_ConfigSinglePinType"
+#endif
+
+/* Compile time size checks of the packed configuration, the array size is negative when a check fails:
+ * 2 bytes per pin, and the whole configuration set within two 64-byte flash lines */
+typedef char Port_ConfigSinglePinSizeCheck[(sizeof(Port_ConfigSinglePinType) == 2U) ? 1 : -1];
+typedef char Port_ConfigSizeCheck[(sizeof(Port_ConfigType) <= 128U) ? 1 : -1];
+
+/* The post-build image header has no padding, so images built on the host match the target layout */
+typedef char Port_ImageHeaderSizeCheck[(sizeof(Port_ImageHeaderType) == 20U) ? 1 : -1];
+
+#if (PORT_SNAPSHOT_API == STD_ON)
+/* The snapshot has no padding, 12 bytes per port and the captured ports word */
+typedef char Port_SnapshotSizeCheck[(sizeof(Port_SnapshotType) == ((PORT_NUMBER_OF_PORTS * 12U) + 4U)) ? 1 : -1];
+#endif
+
 STATIC const Port_ConfigType *Port_ConfigPtr = NULL_PTR;
 STATIC uint8 Port_Status = PORT_NOT_INITIALIZED;
 
+#if (PORT_SWITCH_CONFIGURATION_API == STD_ON)
+/* Incremented by every Port_Init, a switch delta computed before it is computed again */
+STATIC uint32 Port_InitGeneration = 0;
+#endif
+
+#if (PORT_INIT_IMAGE_API == STD_ON)
+/* Configuration set of the post-build image passed to Port_InitImage, its pin table points into the image */
+STATIC Port_ConfigType Port_ImageConfig;
+#endif
+
+/* GPIO Registers base address of each port, indexed by the port number */
+STATIC const uint32 Port_BaseAddress[PORT_NUMBER_OF_PORTS] = {
+    GPIO_PORTA_BASE_ADDRESS,
+    GPIO_PORTB_BASE_ADDRESS,
+    GPIO_PORTC_BASE_ADDRESS,
+    GPIO_PORTD_BASE_ADDRESS,
+    GPIO_PORTE_BASE_ADDRESS,
+    GPIO_PORTF_BASE_ADDRESS};
+
+#if (PORT_SNAPSHOT_API == STD_ON)
+/* GPIO Registers base address of each port through the APB and the AHB aperture, indexed by the
+ * GPIOHBCTL bit of the port and the port number */
+STATIC const uint32 Port_ApertureBaseAddress[2][PORT_NUMBER_OF_PORTS] = {
+    {GPIO_PORTA_APB_BASE_ADDRESS,
+     GPIO_PORTB_APB_BASE_ADDRESS,
+     GPIO_PORTC_APB_BASE_ADDRESS,
+     GPIO_PORTD_APB_BASE_ADDRESS,
+     GPIO_PORTE_APB_BASE_ADDRESS,
+     GPIO_PORTF_APB_BASE_ADDRESS},
+    {GPIO_PORTA_AHB_BASE_ADDRESS,
+     GPIO_PORTB_AHB_BASE_ADDRESS,
+     GPIO_PORTC_AHB_BASE_ADDRESS,
+     GPIO_PORTD_AHB_BASE_ADDRESS,
+     GPIO_PORTE_AHB_BASE_ADDRESS,
+     GPIO_PORTF_AHB_BASE_ADDRESS}};
+#endif
+
+/* Pin ID of the first pin of each port, indexed by the port number */
+STATIC const Port_PinType Port_FirstPinId[PORT_NUMBER_OF_PORTS] = {PA0, PB0, PC0, PD0, PE0, PF0};
+
+#if ((PORT_DEV_ERROR_DETECT == STD_ON) || (PORT_INIT_IMAGE_API == STD_ON))
+/* Allowed modes of each pin from Port_Cfg.h, indexed by the Pin ID */
+STATIC const uint16 Port_PinModes[PORT_NUMBER_OF_PINS] = {
+    PORT_PA0_MODES,
+    PORT_PA1_MODES,
+    PORT_PA2_MODES,
+    PORT_PA3_MODES,
+    PORT_PA4_MODES,
+    PORT_PA5_MODES,
+    PORT_PA6_MODES,
+    PORT_PA7_MODES,
+    PORT_PB0_MODES,
+    PORT_PB1_MODES,
+    PORT_PB2_MODES,
+    PORT_PB3_MODES,
+    PORT_PB4_MODES,
+    PORT_PB5_MODES,
+    PORT_PB6_MODES,
+    PORT_PB7_MODES,
+    PORT_PC0_MODES,
+    PORT_PC1_MODES,
+    PORT_PC2_MODES,
+    PORT_PC3_MODES,
+    PORT_PC4_MODES,
+    PORT_PC5_MODES,
+    PORT_PC6_MODES,
+    PORT_PC7_MODES,
+    PORT_PD0_MODES,
+    PORT_PD1_MODES,
+    PORT_PD2_MODES,
+    PORT_PD3_MODES,
+    PORT_PD4_MODES,
+    PORT_PD5_MODES,
+    PORT_PD6_MODES,
+    PORT_PD7_MODES,
+    PORT_PE0_MODES,
+    PORT_PE1_MODES,
+    PORT_PE2_MODES,
+    PORT_PE3_MODES,
+    PORT_PE4_MODES,
+    PORT_PE5_MODES,
+    PORT_PF0_MODES,
+    PORT_PF1_MODES,
+    PORT_PF2_MODES,
+    PORT_PF3_MODES,
+    PORT_PF4_MODES};
+#endif
+
+#if ((PORT_DEV_ERROR_DETECT == STD_ON) || (PORT_INIT_IMAGE_API == STD_ON))
+/* Modes every pin of a port supports from Port_Cfg.h, the only ones its default can use, indexed by the port number */
+STATIC const uint16 Port_PortModes[PORT_NUMBER_OF_PORTS] = {
+    PORT_PORTA_MODES,
+    PORT_PORTB_MODES,
+    PORT_PORTC_MODES,
+    PORT_PORTD_MODES,
+    PORT_PORTE_MODES,
+    PORT_PORTF_MODES};
+
+/************************************************************************************
+ * Function Name: Port_AreDefaultsValid
+ * Parameters (in): PortDefault - Default configuration of each port, indexed by the port number
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: TRUE if every port default uses a mode all the pins of its port support
+ * Description: Checks the modes of the port defaults.
+ ************************************************************************************/
+STATIC boolean Port_AreDefaultsValid(const Port_ConfigSinglePinType *PortDefault)
+{
+    uint8 port;
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        if ((Port_PortModes[port] & PORT_MODE_BIT(PORT_CONFIG_MODE(PortDefault[port]))) == 0)
+        {
+            return FALSE;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return TRUE;
+}
+#endif
+
+/* Value of the PMCx field of a pin in a mode, analog pins have no digital function selected */
+#define PORT_MODE_PMC(MODE) (((MODE) == ADC_MODE) ? 0U : ((uint32)(MODE) & PMCx_BITS_MASK))
+
+/* Register images of each port folded from the pin configurations by Port_Init */
+STATIC Port_PortImageType Port_PortImage[PORT_NUMBER_OF_PORTS];
+
+/* Pins of each port, indexed by the port number. PE6-PE7 and PF5-PF7 do not exist */
+STATIC const uint8 Port_PortPinsMask[PORT_NUMBER_OF_PORTS] = {0xFFU, 0xFFU, 0xFFU, 0xFFU, 0x3FU, 0x1FU};
+
+/* JTAG pins PC0-PC3 left untouched by the driver, indexed by the port number */
+STATIC const uint8 Port_JtagPinsMask[PORT_NUMBER_OF_PORTS] = {0U, 0U, 0x0FU, 0U, 0U, 0U};
+
+/* Pins PD7 and PF0 locked after reset that need to be unlocked and committed, indexed by the port number */
+STATIC const uint8 Port_CommitPinsMask[PORT_NUMBER_OF_PORTS] = {0U, 0U, 0U, 0x80U, 0U, 0x01U};
+
+#if ((PORT_SET_PIN_DIRECTION_API == STD_ON) || (PORT_SET_PIN_MODE_API == STD_ON))
+/* Hardware descriptor of a pin from its port base address, port number and pin number */
+#define PORT_PIN_DESCRIPTOR(BASE, PORT, PIN) {(BASE), (uint8)(1U << (PIN)), (uint8)((PIN) * 4U), (uint8)(PORT)}
+
+/* Constant hardware descriptor of each pin, indexed by the Pin ID */
+STATIC const Port_PinDescriptorType Port_PinDescriptor[PORT_NUMBER_OF_PINS] = {
+    PORT_PIN_DESCRIPTOR(GPIO_PORTA_BASE_ADDRESS, PORT_PortA, PORT_Pin0),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTA_BASE_ADDRESS, PORT_PortA, PORT_Pin1),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTA_BASE_ADDRESS, PORT_PortA, PORT_Pin2),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTA_BASE_ADDRESS, PORT_PortA, PORT_Pin3),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTA_BASE_ADDRESS, PORT_PortA, PORT_Pin4),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTA_BASE_ADDRESS, PORT_PortA, PORT_Pin5),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTA_BASE_ADDRESS, PORT_PortA, PORT_Pin6),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTA_BASE_ADDRESS, PORT_PortA, PORT_Pin7),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTB_BASE_ADDRESS, PORT_PortB, PORT_Pin0),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTB_BASE_ADDRESS, PORT_PortB, PORT_Pin1),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTB_BASE_ADDRESS, PORT_PortB, PORT_Pin2),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTB_BASE_ADDRESS, PORT_PortB, PORT_Pin3),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTB_BASE_ADDRESS, PORT_PortB, PORT_Pin4),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTB_BASE_ADDRESS, PORT_PortB, PORT_Pin5),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTB_BASE_ADDRESS, PORT_PortB, PORT_Pin6),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTB_BASE_ADDRESS, PORT_PortB, PORT_Pin7),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTC_BASE_ADDRESS, PORT_PortC, PORT_Pin0),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTC_BASE_ADDRESS, PORT_PortC, PORT_Pin1),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTC_BASE_ADDRESS, PORT_PortC, PORT_Pin2),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTC_BASE_ADDRESS, PORT_PortC, PORT_Pin3),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTC_BASE_ADDRESS, PORT_PortC, PORT_Pin4),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTC_BASE_ADDRESS, PORT_PortC, PORT_Pin5),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTC_BASE_ADDRESS, PORT_PortC, PORT_Pin6),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTC_BASE_ADDRESS, PORT_PortC, PORT_Pin7),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTD_BASE_ADDRESS, PORT_PortD, PORT_Pin0),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTD_BASE_ADDRESS, PORT_PortD, PORT_Pin1),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTD_BASE_ADDRESS, PORT_PortD, PORT_Pin2),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTD_BASE_ADDRESS, PORT_PortD, PORT_Pin3),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTD_BASE_ADDRESS, PORT_PortD, PORT_Pin4),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTD_BASE_ADDRESS, PORT_PortD, PORT_Pin5),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTD_BASE_ADDRESS, PORT_PortD, PORT_Pin6),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTD_BASE_ADDRESS, PORT_PortD, PORT_Pin7),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTE_BASE_ADDRESS, PORT_PortE, PORT_Pin0),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTE_BASE_ADDRESS, PORT_PortE, PORT_Pin1),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTE_BASE_ADDRESS, PORT_PortE, PORT_Pin2),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTE_BASE_ADDRESS, PORT_PortE, PORT_Pin3),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTE_BASE_ADDRESS, PORT_PortE, PORT_Pin4),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTE_BASE_ADDRESS, PORT_PortE, PORT_Pin5),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTF_BASE_ADDRESS, PORT_PortF, PORT_Pin0),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTF_BASE_ADDRESS, PORT_PortF, PORT_Pin1),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTF_BASE_ADDRESS, PORT_PortF, PORT_Pin2),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTF_BASE_ADDRESS, PORT_PortF, PORT_Pin3),
+    PORT_PIN_DESCRIPTOR(GPIO_PORTF_BASE_ADDRESS, PORT_PortF, PORT_Pin4)};
+#endif
+
+/* Bit of a pin in the pin bitmaps, indexed by the Pin ID */
+#define PORT_PIN_BIT(PIN) ((uint64)1U << (PIN))
+
+#if ((PORT_SET_PIN_DIRECTION_API == STD_ON) || (PORT_SET_PIN_MODE_API == STD_ON))
+/* JTAG pins PC0-PC3, one bit per Pin ID */
+STATIC const uint64 Port_JtagPins = (uint64)0x0FU << PC0;
+#endif
+
+/* Pins whose direction or mode may be changed during runtime, one bit per Pin ID */
+STATIC uint64 Port_DirectionChangeablePins = 0;
+STATIC uint64 Port_ModeChangeablePins = 0;
+
+/* Ports whose registers have been initialized */
+STATIC uint8 Port_PortInitMask = 0;
+
+/* Port registers written through the register helpers, the configuration registers come first and
+ * are the ones kept in RAM shadows */
+#define PORT_REG_DIR                    (0U)
+#define PORT_REG_AFSEL                  (1U)
+#define PORT_REG_PUR                    (2U)
+#define PORT_REG_PDR                    (3U)
+#define PORT_REG_DEN                    (4U)
+#define PORT_REG_AMSEL                  (5U)
+#define PORT_REG_PCTL                   (6U)
+#define PORT_REG_DATA                   (7U)
+#define PORT_REG_COMMIT                 (8U)
+#define PORT_NUMBER_OF_REGISTERS        (9U)
+
+/* Number of configuration registers of each port kept in RAM shadows */
+#define PORT_NUMBER_OF_SHADOW_REGISTERS (7U)
+
+/* Offsets of the port registers, indexed by their PORT_REG number */
+STATIC const uint16 Port_RegisterOffsets[PORT_NUMBER_OF_REGISTERS] = {
+    PORT_DIR_REG_OFFSET,
+    PORT_ALT_FUNC_REG_OFFSET,
+    PORT_PULL_UP_REG_OFFSET,
+    PORT_PULL_DOWN_REG_OFFSET,
+    PORT_DIGITAL_ENABLE_REG_OFFSET,
+    PORT_ANALOG_MODE_SEL_REG_OFFSET,
+    PORT_CTL_REG_OFFSET,
+    PORT_DATA_REG_OFFSET,
+    PORT_COMMIT_REG_OFFSET};
+
+/* Address of a register of a port */
+#define PORT_REGISTER_ADDRESS(PORT, REG) (Port_BaseAddress[(PORT)] + Port_RegisterOffsets[(REG)])
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+/* Authoritative copies of the configuration registers of each initialized port, indexed by
+ * the port number and the PORT_REG number. The registers are written from them with plain stores */
+STATIC uint32 Port_ShadowRegisters[PORT_NUMBER_OF_PORTS][PORT_NUMBER_OF_SHADOW_REGISTERS];
+#endif
+
+#if (PORT_VERIFY_CONFIGURATION_API == STD_ON)
+/* Expected configuration registers of each port checked by Port_VerifyConfiguration, indexed by the port number */
+STATIC Port_VerifyImageType Port_VerifyImage[PORT_NUMBER_OF_PORTS];
+
+/* Byte of a register in the packed registers of Port_VerifyImageType */
+#define PORT_VERIFY_LANE(REG, VALUE) ((uint64)(uint8)(VALUE) << ((REG) * 8U))
+#endif
+
+#if (PORT_UPDATE_TRANSACTION_API == STD_ON)
+/* Set between Port_BeginUpdate and Port_CommitUpdate */
+STATIC boolean Port_UpdateActive = FALSE;
+
+/* Register bits of each port staged by the pin APIs during an update, only the
+ * AMSEL, PCTL, AFSEL, DEN and DIR fields are used */
+STATIC Port_PortDeltaType Port_UpdateShadow[PORT_NUMBER_OF_PORTS];
+
+/* Stages new values of the BITS of a shadow register and marks them dirty */
+#define PORT_STAGE_BITS(VALUE, MASK, BITS, NEW_VALUE) \
+    do                                                \
+    {                                                 \
+        (MASK) |= (BITS);                             \
+        (VALUE) = ((VALUE) & ~(BITS)) | ((NEW_VALUE) & (BITS)); \
+    } while (0)
+#endif
+
+#if (PORT_REFRESH_DRIFT_DETECTION == STD_ON)
+/* Direction corrections done by Port_RefreshPortDirection since Port_Init */
+STATIC Port_DriftCountersType Port_DriftCounters;
+#endif
+
+#if (PORT_INIT_STATISTICS_API == STD_ON)
+/* Register write counts of the last Port_Init call */
+STATIC Port_InitStatisticsType Port_InitStatistics;
+#endif
+
+#if (PORT_INSTRUMENTATION == STD_ON)
+/* Call statistics of the instrumented APIs since reset */
+STATIC Port_InstrumentationType Port_Instrumentation;
+
+/* Marks the start of an instrumented API call */
+#define PORT_INSTRUMENT_BEGIN() uint32 Port_StartCycles = PORT_GET_CYCLES()
+
+/* Records an instrumented API call, to be placed before every return of the API */
+#define PORT_INSTRUMENT_END(SID) Port_RecordCall((SID), (uint32)(PORT_GET_CYCLES() - Port_StartCycles))
+#else
+#define PORT_INSTRUMENT_BEGIN()
+#define PORT_INSTRUMENT_END(SID)
+#endif
+
+#if (PORT_INSTRUMENTATION == STD_ON)
+/************************************************************************************
+ * Function Name: Port_RecordCall
+ * Parameters (in): ApiId - Service ID of the API, Cycles - Cycles taken by the call
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Adds one call to the statistics of an instrumented API.
+ ************************************************************************************/
+STATIC void Port_RecordCall(uint8 ApiId, uint32 Cycles)
+{
+    Port_ApiStatisticsType *statistics = &Port_Instrumentation.api[ApiId];
+    uint32 value = Cycles;
+    uint8 bucket = 0;
+
+    if ((statistics->calls == 0) || (Cycles < statistics->minCycles))
+    {
+        statistics->minCycles = Cycles;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    if (Cycles > statistics->maxCycles)
+    {
+        statistics->maxCycles = Cycles;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    statistics->calls++;
+    statistics->totalCycles += Cycles;
+
+    /* Bucket of the most significant set bit of the cycle count */
+    while (value > 1U)
+    {
+        value >>= 1;
+        bucket++;
+    }
+    statistics->histogram[bucket]++;
+}
+
+#if (PORT_HOST_BACKEND == STD_OFF)
+/************************************************************************************
+ * Function Name: Port_EnableCycleCounter
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Starts the DWT cycle counter used by the instrumentation.
+ ************************************************************************************/
+STATIC void Port_EnableCycleCounter(void)
+{
+    PORT_SET_REG_BITS(PORT_DEMCR_REG_ADDRESS, PORT_DEMCR_TRCENA_MASK);
+    PORT_SET_REG_BITS(PORT_DWT_CTRL_REG_ADDRESS, PORT_DWT_CTRL_CYCCNTENA_MASK);
+}
+#endif
+#endif
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+/************************************************************************************
+ * Function Name: Port_LoadShadowRegisters
+ * Parameters (in): Port - Port number
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Reads the configuration registers of a clocked port into their shadows.
+ ************************************************************************************/
+STATIC void Port_LoadShadowRegisters(uint8 Port)
+{
+    uint8 reg;
+
+    for (reg = PORT_REG_DIR; reg < PORT_NUMBER_OF_SHADOW_REGISTERS; reg++)
+    {
+        Port_ShadowRegisters[Port][reg] = PORT_READ_REG(PORT_REGISTER_ADDRESS(Port, reg));
+    }
+}
+#endif
+
+#if (PORT_UPDATE_TRANSACTION_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_ReadRegisterValue
+ * Parameters (in): Port - Port number, Reg - PORT_REG number of the register
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Current value of the register
+ * Description: Returns the shadow of a shadowed register without a bus access, or reads the register.
+ ************************************************************************************/
+STATIC uint32 Port_ReadRegisterValue(uint8 Port, uint8 Reg)
+{
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+    if (Reg < PORT_NUMBER_OF_SHADOW_REGISTERS)
+    {
+        return Port_ShadowRegisters[Port][Reg];
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+    return PORT_READ_REG(PORT_REGISTER_ADDRESS(Port, Reg));
+}
+#endif
+
+#if ((PORT_UPDATE_TRANSACTION_API == STD_ON) || (PORT_REFRESH_DRIFT_DETECTION == STD_ON))
+/************************************************************************************
+ * Function Name: Port_StoreRegister
+ * Parameters (in): Port - Port number, Reg - PORT_REG number of the register, Value - New register value
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Writes a whole register and keeps its shadow in step.
+ ************************************************************************************/
+STATIC void Port_StoreRegister(uint8 Port, uint8 Reg, uint32 Value)
+{
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+    if (Reg < PORT_NUMBER_OF_SHADOW_REGISTERS)
+    {
+        Port_ShadowRegisters[Port][Reg] = Value;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+    PORT_WRITE_REG(PORT_REGISTER_ADDRESS(Port, Reg), Value);
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_WriteRegisterBits
+ * Parameters (in): Port - Port number, Reg - PORT_REG number of the register, Mask - Bits to be updated,
+ *                  Value - New value of the bits
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Updates only the masked bits of a register with a single read-modify-write,
+ *              or with a single store from its shadow when the register is shadowed.
+ ************************************************************************************/
+STATIC void Port_WriteRegisterBits(uint8 Port, uint8 Reg, uint32 Mask, uint32 Value)
+{
+    uint32 address = PORT_REGISTER_ADDRESS(Port, Reg);
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+    /* Shadowed registers are written with a plain store computed from their shadow */
+    if (Reg < PORT_NUMBER_OF_SHADOW_REGISTERS)
+    {
+        uint32 *shadow = &Port_ShadowRegisters[Port][Reg];
+
+        *shadow = (*shadow & ~Mask) | (Value & Mask);
+        PORT_WRITE_REG(address, *shadow);
+        return;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+    PORT_WRITE_REG(address, (PORT_READ_REG(address) & ~Mask) | (Value & Mask));
+}
+
+/************************************************************************************
+ * Function Name: Port_PinMaskToPmcMask
+ * Parameters (in): PinMask - Pins of a port
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Mask of the PMCx fields of the pins in the port control register
+ * Description: Spreads every pin bit of a mask to its 4 bits PMCx field.
+ ************************************************************************************/
+STATIC uint32 Port_PinMaskToPmcMask(uint8 PinMask)
+{
+    uint32 pmcMask = 0;
+    uint8 pin;
+
+    for (pin = PORT_Pin0; pin <= PORT_Pin7; pin++)
+    {
+        if ((PinMask & (1U << pin)) != 0)
+        {
+            pmcMask |= (PMCx_BITS_MASK << (pin * 4));
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return pmcMask;
+}
+
+/************************************************************************************
+ * Function Name: Port_WritePinBit
+ * Parameters (in): Pin - Descriptor of the pin, Reg - PORT_REG number of the register, Level - STD_HIGH or STD_LOW
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets or clears the bit of a pin in one of its port registers. With bit-band access
+ *              the bit is changed by one atomic store to its alias word instead of a read-modify-write.
+ ************************************************************************************/
+LOCAL_INLINE void Port_WritePinBit(const Port_PinDescriptorType *Pin, uint8 Reg, uint8 Level)
+{
+#if ((PORT_BIT_BAND_ACCESS == STD_ON) && (PORT_SHADOW_REGISTERS == STD_OFF))
+    /* The pin number is the PMCx shift divided by the 4 bits of each pin */
+    PORT_WRITE_REG(PORT_BIT_BAND_ADDRESS(Pin->base + Port_RegisterOffsets[Reg], Pin->pctlShift >> 2), Level);
+#else
+    Port_WriteRegisterBits(Pin->port, Reg, Pin->bitMask, (Level == STD_LOW) ? 0U : Pin->bitMask);
+#endif
+}
+
+#if ((PORT_SWITCH_CONFIGURATION_API == STD_ON) || (PORT_UPDATE_TRANSACTION_API == STD_ON))
+/************************************************************************************
+ * Function Name: Port_WriteChangedBits
+ * Parameters (in): Port - Port number, Reg - PORT_REG number of the register, Mask - Bits to be updated,
+ *                  Value - New value of the bits
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Updates the masked bits of a register, registers without changed bits are not accessed.
+ ************************************************************************************/
+STATIC void Port_WriteChangedBits(uint8 Port, uint8 Reg, uint32 Mask, uint32 Value)
+{
+    if (Mask != 0)
+    {
+        Port_WriteRegisterBits(Port, Reg, Mask, Value);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+#endif
+
+#if (PORT_REFRESH_DRIFT_DETECTION == STD_ON)
+/************************************************************************************
+ * Function Name: Port_ClearDriftCounters
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Clears the drift counters of every port and pin.
+ ************************************************************************************/
+STATIC void Port_ClearDriftCounters(void)
+{
+    uint8 port;
+    Port_PinType index;
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        Port_DriftCounters.portCorrections[port] = 0;
+    }
+    for (index = PA0; index < PORT_NUMBER_OF_PINS; index++)
+    {
+        Port_DriftCounters.pinCorrections[index] = 0;
+    }
+}
+#endif
+
+#if (PORT_UPDATE_TRANSACTION_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_ClearUpdate
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Drops every change staged in the update shadows.
+ ************************************************************************************/
+STATIC void Port_ClearUpdate(void)
+{
+    uint8 port;
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        Port_UpdateShadow[port].amselMask = 0;
+        Port_UpdateShadow[port].pctlMask = 0;
+        Port_UpdateShadow[port].afselMask = 0;
+        Port_UpdateShadow[port].denMask = 0;
+        Port_UpdateShadow[port].dirMask = 0;
+    }
+}
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_StageDirection
+ * Parameters (in): Port - Port number, PinMask - Pins of the port, DirectionBits - 1 for output, 0 for input
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Records a direction change of pins in the update shadow of their port.
+ ************************************************************************************/
+STATIC void Port_StageDirection(uint8 Port, uint8 PinMask, uint8 DirectionBits)
+{
+    Port_PortDeltaType *shadow = &Port_UpdateShadow[Port];
+
+    PORT_STAGE_BITS(shadow->dir, shadow->dirMask, PinMask, DirectionBits);
+}
+#endif
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_StageMode
+ * Parameters (in): Port - Port number, PinMask - Pins of the port, PmcMask - PMCx fields of the pins,
+ *                  Mode - Port Pin mode
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Records a mode change of pins in the update shadow of their port.
+ ************************************************************************************/
+STATIC void Port_StageMode(uint8 Port, uint8 PinMask, uint32 PmcMask, Port_PinModeType Mode)
+{
+    Port_PortDeltaType *shadow = &Port_UpdateShadow[Port];
+
+    PORT_STAGE_BITS(shadow->amsel, shadow->amselMask, PinMask, (Mode == ADC_MODE) ? 0xFFU : 0U);
+    PORT_STAGE_BITS(shadow->den, shadow->denMask, PinMask, (Mode == ADC_MODE) ? 0U : 0xFFU);
+    PORT_STAGE_BITS(shadow->afsel, shadow->afselMask, PinMask, (Mode == GPIO_MODE) ? 0U : 0xFFU);
+    PORT_STAGE_BITS(shadow->pctl, shadow->pctlMask, PmcMask, PORT_MODE_PMC(Mode) * 0x11111111U);
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_CommitRelease
+ * Parameters (in): Port - Port number, Reg - PORT_REG number of the register, Mask - Dirty bits,
+ *                  Value - Staged value of the bits
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Register value after the release
+ * Description: Reads a dirty register once and clears its staged bits that turn a driver or a
+ *              function off. The register is written only if some bit is cleared.
+ ************************************************************************************/
+STATIC uint32 Port_CommitRelease(uint8 Port, uint8 Reg, uint32 Mask, uint32 Value)
+{
+    uint32 current = Port_ReadRegisterValue(Port, Reg);
+    uint32 released = current & ~(Mask & ~Value);
+
+    if (released != current)
+    {
+        Port_StoreRegister(Port, Reg, released);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return released;
+}
+
+/************************************************************************************
+ * Function Name: Port_CommitEngage
+ * Parameters (in): Port - Port number, Reg - PORT_REG number of the register, Current - Register value after the release,
+ *                  Mask - Dirty bits, Value - Staged value of the bits
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the staged bits of a dirty register that turn a driver or a function on,
+ *              without reading the register again. The register is written only if some bit is set.
+ ************************************************************************************/
+STATIC void Port_CommitEngage(uint8 Port, uint8 Reg, uint32 Current, uint32 Mask, uint32 Value)
+{
+    uint32 engaged = Current | (Mask & Value);
+
+    if (engaged != Current)
+    {
+        Port_StoreRegister(Port, Reg, engaged);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_CountPins
+ * Parameters (in): PinMask - Pins of a port
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Number of pins in the mask
+ * Description: Counts the set bits of a pin mask, one iteration per set bit.
+ ************************************************************************************/
+STATIC uint8 Port_CountPins(uint8 PinMask)
+{
+    uint8 count = 0;
+
+    while (PinMask != 0)
+    {
+        PinMask &= (uint8)(PinMask - 1U);
+        count++;
+    }
+
+    return count;
+}
+
+/************************************************************************************
+ * Function Name: Port_BuildPinBitmaps
+ * Parameters (in): ConfigPtr - Pointer to configuration set.
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Builds the changeable pin bitmaps from the port defaults and then the pins in use,
+ *              so each DET check is a single bit test.
+ ************************************************************************************/
+STATIC void Port_BuildPinBitmaps(const Port_ConfigType *ConfigPtr)
+{
+    uint8 port;
+    uint8 index;
+
+    Port_DirectionChangeablePins = 0;
+    Port_ModeChangeablePins = 0;
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        uint64 portPins = (uint64)Port_PortPinsMask[port] << Port_FirstPinId[port];
+
+        if (PORT_CONFIG_IS_DIRECTION_CHANGEABLE(ConfigPtr->portDefault[port]) == STD_ON)
+        {
+            Port_DirectionChangeablePins |= portPins;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        if (PORT_CONFIG_IS_MODE_CHANGEABLE(ConfigPtr->portDefault[port]) == STD_ON)
+        {
+            Port_ModeChangeablePins |= portPins;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    for (index = 0; index < ConfigPtr->numberOfPins; index++)
+    {
+        Port_ConfigSinglePinType pinConfig = ConfigPtr->pinConfig[index];
+        uint64 pinBit = PORT_PIN_BIT(Port_FirstPinId[PORT_CONFIG_PORT(pinConfig)] + PORT_CONFIG_PIN(pinConfig));
+
+        if (PORT_CONFIG_IS_DIRECTION_CHANGEABLE(pinConfig) == STD_ON)
+        {
+            Port_DirectionChangeablePins |= pinBit;
+        }
+        else
+        {
+            Port_DirectionChangeablePins &= ~pinBit;
+        }
+        if (PORT_CONFIG_IS_MODE_CHANGEABLE(pinConfig) == STD_ON)
+        {
+            Port_ModeChangeablePins |= pinBit;
+        }
+        else
+        {
+            Port_ModeChangeablePins &= ~pinBit;
+        }
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_FoldPinConfig
+ * Parameters (in): Port - Port number, PinMask - Pins of the port, PinConfig - Configuration of the pins
+ * Parameters (inout): Image - Register image of the port.
+ * Parameters (out): None
+ * Return value: Number of register writes the per-pin initialization of the pins would need.
+ * Description: Folds one pin configuration shared by all the pins of PinMask into the port image.
+ ************************************************************************************/
+STATIC uint16 Port_FoldPinConfig(Port_PortImageType *Image, uint8 Port, uint8 PinMask, Port_ConfigSinglePinType PinConfig)
+{
+    Port_PinModeType mode = PORT_CONFIG_MODE(PinConfig);
+    uint8 commitPins;
+    uint8 pinCount;
+    uint16 perPinWrites;
+    uint32 pmcMask;
+
+    /* Clock gating of the port */
+    perPinWrites = Port_CountPins(PinMask);
+
+    /* If PC0-PC3, then do nothing (JTAG Pins) */
+    PinMask &= (uint8)~Port_JtagPinsMask[Port];
+    pinCount = Port_CountPins(PinMask);
+
+    /* If PD7 or PF0, then the pin needs to be unlocked and committed */
+    commitPins = PinMask & Port_CommitPinsMask[Port];
+    Image->commitMask |= commitPins;
+    /* Lock and commit registers */
+    perPinWrites += 2U * Port_CountPins(commitPins);
+
+    Image->ownedMask |= PinMask;
+
+    /* Pins whose direction or mode may be changed during runtime */
+    if (PORT_CONFIG_IS_DIRECTION_CHANGEABLE(PinConfig) == STD_ON)
+    {
+        Image->dirChangeableMask |= PinMask;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+    if (PORT_CONFIG_IS_MODE_CHANGEABLE(PinConfig) == STD_ON)
+    {
+        Image->modeChangeableMask |= PinMask;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Direction, digital enable, analog mode select, alternate function and port control registers */
+    perPinWrites += 5U * pinCount;
+
+    if (PORT_CONFIG_DIRECTION(PinConfig) == PORT_PIN_OUT)
+    {
+        Image->dir |= PinMask;
+        Image->dataMask |= PinMask;
+        if (PORT_CONFIG_INITIAL_VALUE(PinConfig) == PORT_PIN_LEVEL_HIGH)
+        {
+            Image->data |= PinMask;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        /* Data register */
+        perPinWrites += pinCount;
+    }
+    else
+    {
+        Image->pullMask |= PinMask;
+        if (PORT_CONFIG_RESISTOR(PinConfig) == PULL_UP)
+        {
+            Image->pur |= PinMask;
+            perPinWrites += pinCount;
+        }
+        else if (PORT_CONFIG_RESISTOR(PinConfig) == PULL_DOWN)
+        {
+            Image->pdr |= PinMask;
+            perPinWrites += pinCount;
+        }
+        else
+        {
+            /* Both pull up and pull down registers */
+            perPinWrites += 2U * pinCount;
+        }
+    }
+
+    /* ADC Mode */
+    if (mode == ADC_MODE)
+    {
+        Image->amsel |= PinMask;
+    }
+    /* Digital Mode */
+    else
+    {
+        Image->den |= PinMask;
+    }
+
+    pmcMask = Port_PinMaskToPmcMask(PinMask);
+    Image->pctlMask |= pmcMask;
+    /* If alternate (Not DIO) */
+    if (mode != GPIO_MODE)
+    {
+        Image->afsel |= PinMask;
+        Image->pctl |= (pmcMask & (PORT_MODE_PMC(mode) * 0x11111111U));
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return perPinWrites;
+}
+
+/************************************************************************************
+ * Function Name: Port_BuildImages
+ * Parameters (in): ConfigPtr - Pointer to configuration set.
+ * Parameters (inout): None
+ * Parameters (out): Images - Register images of all ports.
+ * Return value: Number of register writes the per-pin initialization would need.
+ * Description: Folds the default of every port and the configuration of every pin in use into
+ *              per-port register images, so each register of each port is written once by Port_Init.
+ *              The work grows with the number of pins in use, the unused pins of a port are folded at once.
+ ************************************************************************************/
+STATIC uint16 Port_BuildImages(const Port_ConfigType *ConfigPtr, Port_PortImageType *Images)
+{
+    uint16 perPinWrites = 0;
+    uint8 usedPins[PORT_NUMBER_OF_PORTS];
+    uint8 port;
+    uint8 index;
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        Images[port].ownedMask = 0;
+        Images[port].commitMask = 0;
+        Images[port].dir = 0;
+        Images[port].data = 0;
+        Images[port].dataMask = 0;
+        Images[port].pur = 0;
+        Images[port].pdr = 0;
+        Images[port].pullMask = 0;
+        Images[port].den = 0;
+        Images[port].amsel = 0;
+        Images[port].afsel = 0;
+        Images[port].dirChangeableMask = 0;
+        Images[port].modeChangeableMask = 0;
+        Images[port].pctl = 0;
+        Images[port].pctlMask = 0;
+        usedPins[port] = 0;
+    }
+
+    for (index = 0; index < ConfigPtr->numberOfPins; index++)
+    {
+        Port_ConfigSinglePinType pinConfig = ConfigPtr->pinConfig[index];
+
+        usedPins[PORT_CONFIG_PORT(pinConfig)] |= (uint8)(1U << PORT_CONFIG_PIN(pinConfig));
+    }
+
+    /* Pins not in use take the default of their port */
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        perPinWrites += Port_FoldPinConfig(&Images[port], port, Port_PortPinsMask[port] & (uint8)~usedPins[port], ConfigPtr->portDefault[port]);
+    }
+
+    for (index = 0; index < ConfigPtr->numberOfPins; index++)
+    {
+        Port_ConfigSinglePinType pinConfig = ConfigPtr->pinConfig[index];
+        uint8 portNumber = PORT_CONFIG_PORT(pinConfig);
+
+        perPinWrites += Port_FoldPinConfig(&Images[portNumber], portNumber, (uint8)(1U << PORT_CONFIG_PIN(pinConfig)), pinConfig);
+    }
+
+    return perPinWrites;
+}
+
+#if (PORT_VERIFY_CONFIGURATION_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_BuildVerifyImages
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Derives the registers expected by Port_VerifyConfiguration from the register images
+ *              of the active configuration set. The direction and mode bits of the changeable pins
+ *              are left out, they may be changed during runtime.
+ ************************************************************************************/
+STATIC void Port_BuildVerifyImages(void)
+{
+    uint8 port;
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        const Port_PortImageType *image = &Port_PortImage[port];
+        Port_VerifyImageType *verify = &Port_VerifyImage[port];
+        uint8 dirMask = image->ownedMask & (uint8)~image->dirChangeableMask;
+        uint8 modeMask = image->ownedMask & (uint8)~image->modeChangeableMask;
+
+        verify->expected = PORT_VERIFY_LANE(PORT_VERIFY_DIR, image->dir) |
+                           PORT_VERIFY_LANE(PORT_VERIFY_AFSEL, image->afsel) |
+                           PORT_VERIFY_LANE(PORT_VERIFY_PUR, image->pur) |
+                           PORT_VERIFY_LANE(PORT_VERIFY_PDR, image->pdr) |
+                           PORT_VERIFY_LANE(PORT_VERIFY_DEN, image->den) |
+                           PORT_VERIFY_LANE(PORT_VERIFY_AMSEL, image->amsel);
+        verify->mask = PORT_VERIFY_LANE(PORT_VERIFY_DIR, dirMask) |
+                       PORT_VERIFY_LANE(PORT_VERIFY_AFSEL, modeMask) |
+                       PORT_VERIFY_LANE(PORT_VERIFY_PUR, image->pullMask) |
+                       PORT_VERIFY_LANE(PORT_VERIFY_PDR, image->pullMask) |
+                       PORT_VERIFY_LANE(PORT_VERIFY_DEN, modeMask) |
+                       PORT_VERIFY_LANE(PORT_VERIFY_AMSEL, modeMask);
+        verify->pctlMask = image->pctlMask & ~Port_PinMaskToPmcMask(image->modeChangeableMask);
+        verify->pctl = image->pctl & verify->pctlMask;
+    }
+}
+#endif
+
+#if ((PORT_DEV_ERROR_DETECT == STD_ON) || (PORT_INIT_IMAGE_API == STD_ON))
+/************************************************************************************
+ * Function Name: Port_ArePinsValid
+ * Parameters (in): PinConfig - Configurations of the pins in use, NumberOfPins - Number of pins in use
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: TRUE if the pins in use can be used
+ * Description: Checks that every pin in use exists, is listed once and supports its mode, so the
+ *              port and pin fields can index the per-port and per-pin tables.
+ ************************************************************************************/
+STATIC boolean Port_ArePinsValid(const Port_ConfigSinglePinType *PinConfig, uint8 NumberOfPins)
+{
+    uint8 usedPins[PORT_NUMBER_OF_PORTS];
+    uint8 port;
+    uint8 index;
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        usedPins[port] = 0;
+    }
+
+    for (index = 0; index < NumberOfPins; index++)
+    {
+        Port_ConfigSinglePinType pinConfig = PinConfig[index];
+        uint8 portNumber = PORT_CONFIG_PORT(pinConfig);
+        uint8 pinMask = (uint8)(1U << PORT_CONFIG_PIN(pinConfig));
+
+        /* Pin that does not exist or listed twice */
+        if ((portNumber >= PORT_NUMBER_OF_PORTS) || ((pinMask & Port_PortPinsMask[portNumber] & (uint8)~usedPins[portNumber]) == 0))
+        {
+            return FALSE;
+        }
+        /* Mode the pin does not support */
+        else if ((Port_PinModes[Port_FirstPinId[portNumber] + PORT_CONFIG_PIN(pinConfig)] & PORT_MODE_BIT(PORT_CONFIG_MODE(pinConfig))) == 0)
+        {
+            return FALSE;
+        }
+        else
+        {
+            usedPins[portNumber] |= pinMask;
+        }
+    }
+
+    return TRUE;
+}
+#endif
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+/************************************************************************************
+ * Function Name: Port_IsConfigValid
+ * Parameters (in): ConfigPtr - Pointer to configuration set.
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: TRUE if the configuration set can be used
+ * Description: Checks that every pin in use exists, is listed once and supports its mode,
+ *              and that every port default uses a mode its whole port supports.
+ ************************************************************************************/
+STATIC boolean Port_IsConfigValid(const Port_ConfigType *ConfigPtr)
+{
+    if ((ConfigPtr->numberOfPins > PORT_NUMBER_OF_PINS) || ((ConfigPtr->numberOfPins != 0) && (NULL_PTR == ConfigPtr->pinConfig)))
+    {
+        return FALSE;
+    }
+    else if (Port_AreDefaultsValid(ConfigPtr->portDefault) == FALSE)
+    {
+        return FALSE;
+    }
+    else
+    {
+        return Port_ArePinsValid(ConfigPtr->pinConfig, ConfigPtr->numberOfPins);
+    }
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_EnableClocks
+ * Parameters (in): PortMask - Ports to be clocked
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Number of register writes done
+ * Description: Opens the clock of all the ports of PortMask that have configured pins with a
+ *              single write and waits until they are ready to be accessed. Ports without
+ *              configured pins stay gated. With the AHB aperture the ports are also moved
+ *              to the AHB with a single write.
+ ************************************************************************************/
+STATIC uint16 Port_EnableClocks(uint8 PortMask)
+{
+    uint32 clockMask = 0;
+    uint8 port;
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        if (((PortMask & (1U << port)) != 0) && (Port_PortImage[port].ownedMask != 0))
+        {
+            clockMask |= (1U << port);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    if (clockMask == 0)
+    {
+        return 0;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+#if (PORT_AHB_APERTURE == STD_ON)
+    /* Each port is reachable through one aperture at a time, move the ports to the AHB before accessing them */
+    PORT_SET_REG_BITS(SYSCTL_GPIOHBCTL_REG_ADDRESS, clockMask);
+#endif
+
+    PORT_SET_REG_BITS(SYSCTL_RCGCGPIO_REG_ADDRESS, clockMask);
+
+    /* Wait until all the required ports are ready to be accessed */
+    while ((PORT_READ_REG(SYSCTL_PRGPIO_REG_ADDRESS) & clockMask) != clockMask)
+    {
+        /* Do Nothing */
+    }
+
+#if (PORT_AHB_APERTURE == STD_ON)
+    return 2U;
+#else
+    return 1U;
+#endif
+}
+
+/************************************************************************************
+ * Function Name: Port_WritePortImage
+ * Parameters (in): Port - Port number
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Number of register writes done
+ * Description: Writes the register images of a port, each register once under the mask of
+ *              the configured pins. The clock of the port must already be enabled.
+ ************************************************************************************/
+STATIC uint16 Port_WritePortImage(uint8 Port)
+{
+    const Port_PortImageType *image = &Port_PortImage[Port];
+    uint32 base = Port_BaseAddress[Port];
+    uint16 writes = 0;
+
+    /* Only the JTAG pins of this port are configured */
+    if (image->ownedMask == 0)
+    {
+        return 0;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+    /* The shadows start from the register values of the freshly clocked port */
+    Port_LoadShadowRegisters(Port);
+#endif
+
+    /* If PD7 or PF0 are configured, then we need to unlock and commit */
+    if (image->commitMask != 0)
+    {
+        /* Unlock port */
+        PORT_WRITE_REG(base + PORT_LOCK_REG_OFFSET, PORT_UNLOCK_VALUE);
+
+        /* Set the required bits in commit register */
+        Port_WriteRegisterBits(Port, PORT_REG_COMMIT, image->commitMask, image->commitMask);
+        writes += 2U;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Select the pin functions first, then drive the initial levels before the directions */
+    Port_WriteRegisterBits(Port, PORT_REG_AMSEL, image->ownedMask, image->amsel);
+    Port_WriteRegisterBits(Port, PORT_REG_PCTL, image->pctlMask, image->pctl);
+    Port_WriteRegisterBits(Port, PORT_REG_AFSEL, image->ownedMask, image->afsel);
+    Port_WriteRegisterBits(Port, PORT_REG_PUR, image->pullMask, image->pur);
+    Port_WriteRegisterBits(Port, PORT_REG_PDR, image->pullMask, image->pdr);
+    Port_WriteRegisterBits(Port, PORT_REG_DEN, image->ownedMask, image->den);
+    Port_WriteRegisterBits(Port, PORT_REG_DATA, image->dataMask, image->data);
+    Port_WriteRegisterBits(Port, PORT_REG_DIR, image->ownedMask, image->dir);
+
+    return writes + 8U;
+}
+
+/************************************************************************************
+ * Service Name: Port_Init
+ * Service ID[hex]: 0x00
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): ConfigPtr - Pointer to configuration set.
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Initializes the Port Driver module.
+ ************************************************************************************/
+void Port_Init(const Port_ConfigType *ConfigPtr)
+{
+    PORT_TRACE_CONTEXT(PORT_INIT_SID, PORT_TRACE_NO_PIN);
+#if ((PORT_INSTRUMENTATION == STD_ON) && (PORT_HOST_BACKEND == STD_OFF))
+    /* The cycle counter runs before the first instrumented call */
+    Port_EnableCycleCounter();
+#endif
+    PORT_INSTRUMENT_BEGIN();
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* check if the input configuration pointer is not a NULL_PTR */
+    if ((NULL_PTR == ConfigPtr) || (Port_IsConfigValid(ConfigPtr) == FALSE))
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_INIT_FAILED);
+    }
+    else
+#endif
+    {
+        uint8 initMask;
+        uint16 perPinWrites;
+        uint16 writes = 0;
+        uint8 port;
+
+        /*
+         * Set the module state to initialized and point to the PB configuration structure using a global pointer.
+         * This global pointer is global to be used by other functions to read the PB configuration structures
+         */
+        Port_Status = PORT_INITIALIZED;
+        Port_ConfigPtr = ConfigPtr;
+#if (PORT_SWITCH_CONFIGURATION_API == STD_ON)
+        /* Switch deltas were computed from the images of the previous initialization */
+        Port_InitGeneration++;
+#endif
+#if (PORT_UPDATE_TRANSACTION_API == STD_ON)
+        /* Changes staged against the previous configuration are dropped */
+        Port_UpdateActive = FALSE;
+        Port_ClearUpdate();
+#endif
+
+        /* Fold the pin configurations into one image per port */
+        perPinWrites = Port_BuildImages(ConfigPtr, Port_PortImage);
+        Port_BuildPinBitmaps(ConfigPtr);
+#if (PORT_VERIFY_CONFIGURATION_API == STD_ON)
+        Port_BuildVerifyImages();
+#endif
+
+#if (PORT_REFRESH_DRIFT_DETECTION == STD_ON)
+        Port_ClearDriftCounters();
+#endif
+
+        /* All the ports are initialized here unless lazy initialization leaves the non early ports to Port_InitPort */
+        initMask = PORT_ALL_PORTS_MASK;
+#if (PORT_INIT_PORT_API == STD_ON)
+        initMask &= ConfigPtr->earlyPorts;
+#endif
+
+        /* Open clock for all the required ports at once */
+        writes += Port_EnableClocks(initMask);
+
+        /* Early ports are initialized first to get their outputs to a safe state as soon as possible */
+        for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+        {
+            if ((initMask & ConfigPtr->earlyPorts & (1U << port)) != 0)
+            {
+                writes += Port_WritePortImage(port);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+        {
+            if ((initMask & ~ConfigPtr->earlyPorts & (1U << port)) != 0)
+            {
+                writes += Port_WritePortImage(port);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+        Port_PortInitMask = initMask;
+
+#if (PORT_INIT_STATISTICS_API == STD_ON)
+        Port_InitStatistics.perPinWrites = perPinWrites;
+        Port_InitStatistics.coalescedWrites = writes;
+#else
+        (void)perPinWrites;
+        (void)writes;
+#endif
+    }
+
+    PORT_INSTRUMENT_END(PORT_INIT_SID);
+}
+
+/************************************************************************************
+ * Service Name: Port_SetPinDirection
+ * Service ID[hex]: 0x01
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Pin - Port Pin ID number, Direction - Port Pin Direction
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the port pin direction.
+ ************************************************************************************/
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
+{
+    PORT_TRACE_CONTEXT(PORT_SET_PIN_DIRECTION_SID, Pin);
+    PORT_INSTRUMENT_BEGIN();
+
+    /* Registers of the pin, from the constant descriptor table */
+    const Port_PinDescriptorType *descriptor;
+
+    /************************************************ DET Errors Check ****************************************/
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Port status uninitialized DET error */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_SID, PORT_E_UNINIT);
+        PORT_INSTRUMENT_END(PORT_SET_PIN_DIRECTION_SID);
+        return;
+    }
+    /* Invalid port pin ID DET error, the Pin IDs are dense from PA0 to PF4 */
+    else if (Pin >= PORT_NUMBER_OF_PINS)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_SID, PORT_E_PARAM_PIN);
+        PORT_INSTRUMENT_END(PORT_SET_PIN_DIRECTION_SID);
+        return;
+    }
+#if (PORT_INIT_PORT_API == STD_ON)
+    /* Port of the pin not initialized yet DET error */
+    else if ((Port_PortInitMask & (1U << Port_PinDescriptor[Pin].port)) == 0)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_SID, PORT_E_UNINIT);
+        PORT_INSTRUMENT_END(PORT_SET_PIN_DIRECTION_SID);
+        return;
+    }
+#endif
+    /* Direction of the pin is configured unchangeable DET error */
+    else if ((Port_DirectionChangeablePins & PORT_PIN_BIT(Pin)) == 0)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+        PORT_INSTRUMENT_END(PORT_SET_PIN_DIRECTION_SID);
+        return;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+
+    /************************************************ JTAG Pins Check ****************************************/
+    if ((Port_JtagPins & PORT_PIN_BIT(Pin)) != 0)
+    {
+        PORT_INSTRUMENT_END(PORT_SET_PIN_DIRECTION_SID);
+        return;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    descriptor = &Port_PinDescriptor[Pin];
+
+#if (PORT_UPDATE_TRANSACTION_API == STD_ON)
+    /* During an update the direction is only staged, Port_CommitUpdate writes it */
+    if ((Port_UpdateActive == TRUE) && ((Direction == PORT_PIN_OUT) || (Direction == PORT_PIN_IN)))
+    {
+        Port_StageDirection(descriptor->port, descriptor->bitMask, (Direction == PORT_PIN_OUT) ? 0xFFU : 0U);
+    }
+    else
+#endif
+    if (Direction == PORT_PIN_OUT)
+    {
+        /* Set corresponding pin in the port direction register */
+        Port_WritePinBit(descriptor, PORT_REG_DIR, STD_HIGH);
+    }
+    else if (Direction == PORT_PIN_IN)
+    {
+        /* Clear corresponding pin in the port direction register */
+        Port_WritePinBit(descriptor, PORT_REG_DIR, STD_LOW);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    PORT_INSTRUMENT_END(PORT_SET_PIN_DIRECTION_SID);
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_RefreshPortDirection
+ * Service ID[hex]: 0x02
+ * Sync/Async: Synchronous
+ * Reentrancy: Non Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Refreshes port direction. The expected direction of the pins that are not
+ *              direction changeable is rewritten with one masked write per port. With drift
+ *              detection the register is read once and only written back when it differs.
+ ************************************************************************************/
+void Port_RefreshPortDirection(void)
+{
+    PORT_TRACE_CONTEXT(PORT_REFRESH_PORT_DIRECTION_SID, PORT_TRACE_NO_PIN);
+    PORT_INSTRUMENT_BEGIN();
+
+    /************************************************ DET Error checks ****************************************/
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Port status uninitialized DET error */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_REFRESH_PORT_DIRECTION_SID, PORT_E_UNINIT);
+        PORT_INSTRUMENT_END(PORT_REFRESH_PORT_DIRECTION_SID);
+        return;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+    uint8 port;
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        /* Pins configured as direction changeable during runtime are excluded from refreshing, JTAG pins are not owned */
+        uint8 refreshMask = Port_PortImage[port].ownedMask & (uint8)~Port_PortImage[port].dirChangeableMask;
+
+        /* Ports left to Port_InitPort are refreshed once they are initialized */
+        if ((refreshMask != 0) && ((Port_PortInitMask & (1U << port)) != 0))
+        {
+#if (PORT_REFRESH_DRIFT_DETECTION == STD_ON)
+            uint32 dir = PORT_READ_REG(PORT_REGISTER_ADDRESS(port, PORT_REG_DIR));
+            uint8 driftMask = (uint8)(dir ^ Port_PortImage[port].dir) & refreshMask;
+
+            /* The direction register is only rewritten when it drifted from the expected image */
+            if (driftMask != 0)
+            {
+                uint8 pin;
+
+                Port_StoreRegister(port, PORT_REG_DIR, (dir & ~(uint32)refreshMask) | (Port_PortImage[port].dir & refreshMask));
+
+                if (Port_DriftCounters.portCorrections[port] < PORT_DRIFT_COUNTER_MAX)
+                {
+                    Port_DriftCounters.portCorrections[port]++;
+                }
+                else
+                {
+                    /* Do Nothing */
+                }
+                for (pin = PORT_Pin0; pin <= PORT_Pin7; pin++)
+                {
+                    if (((driftMask & (1U << pin)) != 0) && (Port_DriftCounters.pinCorrections[Port_FirstPinId[port] + pin] < PORT_DRIFT_COUNTER_MAX))
+                    {
+                        Port_DriftCounters.pinCorrections[Port_FirstPinId[port] + pin]++;
+                    }
+                    else
+                    {
+                        /* Do Nothing */
+                    }
+                }
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+#else
+            Port_WriteRegisterBits(port, PORT_REG_DIR, refreshMask, Port_PortImage[port].dir);
+#endif
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    PORT_INSTRUMENT_END(PORT_REFRESH_PORT_DIRECTION_SID);
+}
+
+/************************************************************************************
+ * Service Name: Port_GetVersionInfo
+ * Service ID[hex]: 0x03
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+ * Return value: None
+ * Description: Returns the version information of this module.
+ ************************************************************************************/
+#if (PORT_VERSION_INFO_API == STD_ON)
+void Port_GetVersionInfo(Std_VersionInfoType *versioninfo)
+{
+    /************************************************ DET Error checks ****************************************/
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if input pointer is not Null pointer */
+    if (NULL_PTR == versioninfo)
+    {
+        /* Report to DET  */
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_VERSION_INFO_SID, PORT_E_PARAM_POINTER);
+    }
+    else
+#endif
+    {
+        /* Copy the vendor Id */
+        versioninfo->vendorID = (uint16)PORT_VENDOR_ID;
+        /* Copy the module Id */
+        versioninfo->moduleID = (uint16)PORT_MODULE_ID;
+        /* Copy Software Major Version */
+        versioninfo->sw_major_version = (uint8)PORT_SW_MAJOR_VERSION;
+        /* Copy Software Minor Version */
+        versioninfo->sw_minor_version = (uint8)PORT_SW_MINOR_VERSION;
+        /* Copy Software Patch Version */
+        versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
+    }
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_SetPinMode
+ * Service ID[hex]: 0x04
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Pin - Port Pin ID number, Mode - New Port Pin mode to be set on port pin
+ * Parameters (inout): None
+ * Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+ * Return value: None
+ * Description: Sets the port pin mode.
+ ************************************************************************************/
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
+{
+    PORT_TRACE_CONTEXT(PORT_SET_PIN_MODE_SID, Pin);
+    PORT_INSTRUMENT_BEGIN();
+
+    /* Registers of the pin, from the constant descriptor table */
+    const Port_PinDescriptorType *descriptor;
+
+    /************************************************ DET Errors Check ****************************************/
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Port status uninitialized DET error */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_UNINIT);
+        PORT_INSTRUMENT_END(PORT_SET_PIN_MODE_SID);
+        return;
+    }
+    /* Invalid port pin ID DET error, the Pin IDs are dense from PA0 to PF4 */
+    else if (Pin >= PORT_NUMBER_OF_PINS)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
+        PORT_INSTRUMENT_END(PORT_SET_PIN_MODE_SID);
+        return;
+    }
+#if (PORT_INIT_PORT_API == STD_ON)
+    /* Port of the pin not initialized yet DET error */
+    else if ((Port_PortInitMask & (1U << Port_PinDescriptor[Pin].port)) == 0)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_UNINIT);
+        PORT_INSTRUMENT_END(PORT_SET_PIN_MODE_SID);
+        return;
+    }
+#endif
+    /* Mode not supported by the pin DET error, the range check guards the bit test shift */
+    else if ((Mode >= PORT_NUMBER_OF_PIN_MODES) || ((Port_PinModes[Pin] & PORT_MODE_BIT(Mode)) == 0))
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_PARAM_INVALID_MODE);
+        PORT_INSTRUMENT_END(PORT_SET_PIN_MODE_SID);
+        return;
+    }
+    /* Mode of the pin is configured unchangeable DET error */
+    else if ((Port_ModeChangeablePins & PORT_PIN_BIT(Pin)) == 0)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_MODE_UNCHANGEABLE);
+        PORT_INSTRUMENT_END(PORT_SET_PIN_MODE_SID);
+        return;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+
+    /************************************************ JTAG Pins Check ****************************************/
+    if ((Port_JtagPins & PORT_PIN_BIT(Pin)) != 0)
+    {
+        PORT_INSTRUMENT_END(PORT_SET_PIN_MODE_SID);
+        return;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    descriptor = &Port_PinDescriptor[Pin];
+
+#if (PORT_UPDATE_TRANSACTION_API == STD_ON)
+    /* During an update the mode is only staged, Port_CommitUpdate writes it */
+    if (Port_UpdateActive == TRUE)
+    {
+        Port_StageMode(descriptor->port, descriptor->bitMask, (PMCx_BITS_MASK << descriptor->pctlShift), Mode);
+        PORT_INSTRUMENT_END(PORT_SET_PIN_MODE_SID);
+        return;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+
+    /* ADC Mode */
+    if (Mode == ADC_MODE)
+    {
+        /* Clear corresponding bit in the digital enable register */
+        Port_WritePinBit(descriptor, PORT_REG_DEN, STD_LOW);
+
+        /* Set corresponding bit in the analog mode select register */
+        Port_WritePinBit(descriptor, PORT_REG_AMSEL, STD_HIGH);
+    }
+    /* Digital Mode */
+    else
+    {
+        /* Set corresponding bit in the digital enable register */
+        Port_WritePinBit(descriptor, PORT_REG_DEN, STD_HIGH);
+
+        /* Clear corresponding bit in the analog mode select register */
+        Port_WritePinBit(descriptor, PORT_REG_AMSEL, STD_LOW);
+    }
+
+    /* If mode is DIO */
+    if (Mode == GPIO_MODE)
+    {
+        /* Clear corresponding bit in the alternate function register */
+        Port_WritePinBit(descriptor, PORT_REG_AFSEL, STD_LOW);
+
+        /* Clear PMCx bits in port control register */
+        Port_WriteRegisterBits(descriptor->port, PORT_REG_PCTL, (PMCx_BITS_MASK << descriptor->pctlShift), 0U);
+    }
+    /* If alternate (Not DIO) */
+    else
+    {
+        /* Set corresponding bit in the alternate function register */
+        Port_WritePinBit(descriptor, PORT_REG_AFSEL, STD_HIGH);
+
+        /* Set the PMCx bits in port control register according to the required mode */
+        Port_WriteRegisterBits(descriptor->port, PORT_REG_PCTL, (PMCx_BITS_MASK << descriptor->pctlShift),
+                               (PORT_MODE_PMC(Mode) << descriptor->pctlShift));
+    }
+
+    PORT_INSTRUMENT_END(PORT_SET_PIN_MODE_SID);
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_GetInitStatistics
+ * Service ID[hex]: 0x05
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): Statistics - Pointer to where to store the register write counts of Port_Init.
+ * Return value: None
+ * Description: Returns the register writes done by the last Port_Init call and the writes
+ *              a per-pin initialization of the same configuration would have needed.
+ ************************************************************************************/
+#if (PORT_INIT_STATISTICS_API == STD_ON)
+void Port_GetInitStatistics(Port_InitStatisticsType *Statistics)
+{
+    /************************************************ DET Error checks ****************************************/
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if input pointer is not Null pointer */
+    if (NULL_PTR == Statistics)
+    {
+        /* Report to DET  */
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_INIT_STATISTICS_SID, PORT_E_PARAM_POINTER);
+    }
+    else
+#endif
+    {
+        *Statistics = Port_InitStatistics;
+    }
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_SetPortPinsDirection
+ * Service ID[hex]: 0x06
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port - Port number, PinMask - Pins of the port to be changed,
+ *                  DirectionBits - New direction of each pin in PinMask (1: output, 0: input)
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the direction of a group of pins of one port with a single write
+ *              of the port direction register.
+ ************************************************************************************/
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+void Port_SetPortPinsDirection(uint8 Port, uint8 PinMask, uint8 DirectionBits)
+{
+    PORT_TRACE_CONTEXT(PORT_SET_PORT_PINS_DIRECTION_SID, PORT_TRACE_NO_PIN);
+
+    /************************************************ DET Errors Check ****************************************/
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Port status uninitialized DET error */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_PINS_DIRECTION_SID, PORT_E_UNINIT);
+        return;
+    }
+    /* Invalid port number DET error */
+    else if (Port >= PORT_NUMBER_OF_PORTS)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_PINS_DIRECTION_SID, PORT_E_PARAM_PIN);
+        return;
+    }
+    /* Port not initialized yet DET error */
+    else if ((Port_PortInitMask & (1U << Port)) == 0)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_PINS_DIRECTION_SID, PORT_E_UNINIT);
+        return;
+    }
+    /* Direction of one of the pins is configured unchangeable DET error */
+    else if ((PinMask & ~Port_PortImage[Port].dirChangeableMask) != 0)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_PINS_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE);
+        return;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+
+    /* Only the changeable pins are touched, JTAG pins are never changeable */
+    PinMask &= Port_PortImage[Port].dirChangeableMask;
+#if (PORT_UPDATE_TRANSACTION_API == STD_ON)
+    /* During an update the directions are only staged, Port_CommitUpdate writes them */
+    if ((Port_UpdateActive == TRUE) && (PinMask != 0))
+    {
+        Port_StageDirection(Port, PinMask, DirectionBits);
+    }
+    else
+#endif
+    if (PinMask != 0)
+    {
+        Port_WriteRegisterBits(Port, PORT_REG_DIR, PinMask, DirectionBits);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+#endif
+
+#if ((PORT_SET_PIN_MODE_API == STD_ON) && (PORT_DEV_ERROR_DETECT == STD_ON))
+/************************************************************************************
+ * Function Name: Port_IsModeAllowed
+ * Parameters (in): Port - Port number, PinMask - Pins of the port, Mode - Port Pin mode
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: TRUE if every configured pin of PinMask supports the mode
+ * Description: Tests the mode against the allowed modes bitmap of each configured pin of PinMask.
+ ************************************************************************************/
+STATIC boolean Port_IsModeAllowed(uint8 Port, uint8 PinMask, Port_PinModeType Mode)
+{
+    uint8 pin;
+
+    if (Mode >= PORT_NUMBER_OF_PIN_MODES)
+    {
+        return FALSE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    /* Pins that are not configured are reported by the unchangeable check */
+    PinMask &= Port_PortImage[Port].ownedMask;
+    for (pin = PORT_Pin0; PinMask != 0; pin++, PinMask >>= 1)
+    {
+        if (((PinMask & 1U) != 0) && ((Port_PinModes[Port_FirstPinId[Port] + pin] & PORT_MODE_BIT(Mode)) == 0))
+        {
+            return FALSE;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return TRUE;
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_SetPortPinsMode
+ * Service ID[hex]: 0x07
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): Port - Port number, PinMask - Pins of the port to be changed,
+ *                  Mode - New Port Pin mode to be set on all the pins in PinMask
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the mode of a group of pins of one port with a single write of each
+ *              of the port digital enable, analog mode select, alternate function and control registers.
+ ************************************************************************************/
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+void Port_SetPortPinsMode(uint8 Port, uint8 PinMask, Port_PinModeType Mode)
+{
+    PORT_TRACE_CONTEXT(PORT_SET_PORT_PINS_MODE_SID, PORT_TRACE_NO_PIN);
+
+    /************************************************ DET Errors Check ****************************************/
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Port status uninitialized DET error */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_PINS_MODE_SID, PORT_E_UNINIT);
+        return;
+    }
+    /* Invalid port number DET error */
+    else if (Port >= PORT_NUMBER_OF_PORTS)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_PINS_MODE_SID, PORT_E_PARAM_PIN);
+        return;
+    }
+    /* Port not initialized yet DET error */
+    else if ((Port_PortInitMask & (1U << Port)) == 0)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_PINS_MODE_SID, PORT_E_UNINIT);
+        return;
+    }
+    /* Mode not supported by one of the pins DET error */
+    else if (Port_IsModeAllowed(Port, PinMask, Mode) == FALSE)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_PINS_MODE_SID, PORT_E_PARAM_INVALID_MODE);
+        return;
+    }
+    /* Mode of one of the pins is configured unchangeable DET error */
+    else if ((PinMask & ~Port_PortImage[Port].modeChangeableMask) != 0)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PORT_PINS_MODE_SID, PORT_E_MODE_UNCHANGEABLE);
+        return;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+
+    /* Only the changeable pins are touched, JTAG pins are never changeable */
+    PinMask &= Port_PortImage[Port].modeChangeableMask;
+#if (PORT_UPDATE_TRANSACTION_API == STD_ON)
+    /* During an update the modes are only staged, Port_CommitUpdate writes them */
+    if ((Port_UpdateActive == TRUE) && (PinMask != 0))
+    {
+        Port_StageMode(Port, PinMask, Port_PinMaskToPmcMask(PinMask), Mode);
+    }
+    else
+#endif
+    if (PinMask != 0)
+    {
+        uint32 pmcMask = Port_PinMaskToPmcMask(PinMask);
+
+        /* ADC Mode: analog mode select set and digital enable cleared, Digital Mode: the opposite */
+        Port_WriteRegisterBits(Port, PORT_REG_DEN, PinMask, (Mode == ADC_MODE) ? 0U : 0xFFU);
+        Port_WriteRegisterBits(Port, PORT_REG_AMSEL, PinMask, (Mode == ADC_MODE) ? 0xFFU : 0U);
+
+        /* DIO: alternate function cleared, alternate (Not DIO): alternate function set and PMCx fields set to the mode */
+        Port_WriteRegisterBits(Port, PORT_REG_AFSEL, PinMask, (Mode == GPIO_MODE) ? 0U : 0xFFU);
+        Port_WriteRegisterBits(Port, PORT_REG_PCTL, pmcMask, PORT_MODE_PMC(Mode) * 0x11111111U);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_GetDriftCounters
+ * Service ID[hex]: 0x08
+ * Sync/Async: Synchronous
+ * Reentrancy: Reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): Counters - Pointer to where to store the direction corrections counters.
+ * Return value: None
+ * Description: Returns how many times Port_RefreshPortDirection found a drifted direction
+ *              register since Port_Init, per port and per pin.
+ ************************************************************************************/
+#if (PORT_REFRESH_DRIFT_DETECTION == STD_ON)
+void Port_GetDriftCounters(Port_DriftCountersType *Counters)
+{
+    /************************************************ DET Error checks ****************************************/
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if input pointer is not Null pointer */
+    if (NULL_PTR == Counters)
+    {
+        /* Report to DET  */
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_DRIFT_COUNTERS_SID, PORT_E_PARAM_POINTER);
+    }
+    else
+#endif
+    {
+        *Counters = Port_DriftCounters;
+    }
+}
+#endif
+
 /************************************************************************************
- * Service Name: Port_Init
- * Service ID[hex]: 0x00
+ * Service Name: Port_InitPort
+ * Service ID[hex]: 0x09
  * Sync/Async: Synchronous
  * Reentrancy: Non reentrant
- * Parameters (in): ConfigPtr - Pointer to configuration set.
+ * Parameters (in): Port - Port number
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Initializes the Port Driver module.
+ * Description: Initializes one port of the configuration set passed to Port_Init. Ports that
+ *              are not marked early in the configuration are left by Port_Init to this API,
+ *              so they can be initialized later from a background task.
+ ************************************************************************************/
+#if (PORT_INIT_PORT_API == STD_ON)
+void Port_InitPort(uint8 Port)
+{
+    PORT_TRACE_CONTEXT(PORT_INIT_PORT_SID, PORT_TRACE_NO_PIN);
+
+    /************************************************ DET Errors Check ****************************************/
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Port status uninitialized DET error */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_PORT_SID, PORT_E_UNINIT);
+        return;
+    }
+    /* Invalid port number DET error */
+    else if (Port >= PORT_NUMBER_OF_PORTS)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_PORT_SID, PORT_E_PARAM_PIN);
+        return;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+
+    /* Ports already initialized are left untouched */
+    if ((Port_PortInitMask & (1U << Port)) == 0)
+    {
+        (void)Port_EnableClocks((uint8)(1U << Port));
+        (void)Port_WritePortImage(Port);
+        Port_PortInitMask |= (uint8)(1U << Port);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+}
+#endif
+
+#if (PORT_SWITCH_CONFIGURATION_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_ChangedBits
+ * Parameters (in): OldValue, OldMask - Register bits owned by the active configuration set,
+ *                  NewValue, NewMask - Register bits owned by the new configuration set
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Register bits to be written to switch to the new configuration set
+ * Description: Bits newly owned by the new set are always written, bits owned by both sets
+ *              only when their value differs and bits the new set does not own are left alone.
+ ************************************************************************************/
+STATIC uint32 Port_ChangedBits(uint32 OldValue, uint32 OldMask, uint32 NewValue, uint32 NewMask)
+{
+    return (NewMask & ~OldMask) | (NewMask & OldMask & (OldValue ^ NewValue));
+}
+
+/************************************************************************************
+ * Function Name: Port_PrepareDelta
+ * Parameters (in): ConfigPtr - Pointer to the new configuration set
+ * Parameters (inout): None
+ * Parameters (out): Delta - Switch from the active configuration set to ConfigPtr
+ * Return value: None
+ * Description: Computes the register images of the new configuration set and the bits
+ *              of every register that differ from the active images.
+ ************************************************************************************/
+STATIC void Port_PrepareDelta(const Port_ConfigType *ConfigPtr, Port_ConfigDeltaType *Delta)
+{
+    uint8 port;
+
+    (void)Port_BuildImages(ConfigPtr, Delta->toImages);
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        const Port_PortImageType *from = &Port_PortImage[port];
+        const Port_PortImageType *to = &Delta->toImages[port];
+        Port_PortDeltaType *delta = &Delta->ports[port];
+
+        delta->commitMask = to->commitMask & (uint8)~from->commitMask;
+        delta->amsel = to->amsel;
+        delta->amselMask = (uint8)Port_ChangedBits(from->amsel, from->ownedMask, to->amsel, to->ownedMask);
+        delta->pctl = to->pctl;
+        delta->pctlMask = Port_ChangedBits(from->pctl, from->pctlMask, to->pctl, to->pctlMask);
+        delta->afsel = to->afsel;
+        delta->afselMask = (uint8)Port_ChangedBits(from->afsel, from->ownedMask, to->afsel, to->ownedMask);
+        delta->pur = to->pur;
+        delta->purMask = (uint8)Port_ChangedBits(from->pur, from->pullMask, to->pur, to->pullMask);
+        delta->pdr = to->pdr;
+        delta->pdrMask = (uint8)Port_ChangedBits(from->pdr, from->pullMask, to->pdr, to->pullMask);
+        delta->den = to->den;
+        delta->denMask = (uint8)Port_ChangedBits(from->den, from->ownedMask, to->den, to->ownedMask);
+        delta->data = to->data;
+        delta->dataMask = (uint8)Port_ChangedBits(from->data, from->dataMask, to->data, to->dataMask);
+        delta->dir = to->dir;
+        delta->dirMask = (uint8)Port_ChangedBits(from->dir, from->ownedMask, to->dir, to->ownedMask);
+    }
+
+    Delta->fromConfig = Port_ConfigPtr;
+    Delta->toConfig = ConfigPtr;
+    Delta->generation = Port_InitGeneration;
+}
+
+/************************************************************************************
+ * Service Name: Port_SwitchConfiguration
+ * Service ID[hex]: 0x0A
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): ConfigPtr - Pointer to the configuration set to switch to.
+ * Parameters (inout): Delta - Switch between the active configuration set and ConfigPtr, computed
+ *                     on first use and reused as long as it is called for the same pair of sets
+ *                     since the last Port_Init. The configuration sets must not be modified
+ *                     while a delta refers to them.
+ * Parameters (out): None
+ * Return value: None
+ * Description: Switches from the active configuration set to another one, writing only the
+ *              registers and bits that differ between the two sets. Like Port_Init it drops an
+ *              open update and clears the drift counters.
+ ************************************************************************************/
+void Port_SwitchConfiguration(const Port_ConfigType *ConfigPtr, Port_ConfigDeltaType *Delta)
+{
+    uint8 port;
+    uint8 clockMask = 0;
+
+    PORT_TRACE_CONTEXT(PORT_SWITCH_CONFIGURATION_SID, PORT_TRACE_NO_PIN);
+
+    /************************************************ DET Errors Check ****************************************/
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Port status uninitialized DET error */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCH_CONFIGURATION_SID, PORT_E_UNINIT);
+        return;
+    }
+    /* Null configuration or delta pointer DET error */
+    else if ((NULL_PTR == ConfigPtr) || (NULL_PTR == Delta))
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCH_CONFIGURATION_SID, PORT_E_PARAM_POINTER);
+        return;
+    }
+    /* Invalid configuration set DET error */
+    else if (Port_IsConfigValid(ConfigPtr) == FALSE)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SWITCH_CONFIGURATION_SID, PORT_E_INIT_FAILED);
+        return;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+
+    /* The delta is computed on its first use for this pair of configuration sets and again after every Port_Init */
+    if ((Delta->fromConfig != Port_ConfigPtr) || (Delta->toConfig != ConfigPtr) ||
+        (Delta->generation != Port_InitGeneration))
+    {
+        Port_PrepareDelta(ConfigPtr, Delta);
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#if (PORT_UPDATE_TRANSACTION_API == STD_ON)
+    /* Changes staged against the previous configuration set are dropped, as by Port_Init */
+    Port_UpdateActive = FALSE;
+    Port_ClearUpdate();
+#endif
+#if (PORT_REFRESH_DRIFT_DETECTION == STD_ON)
+    /* The counters count corrections against the previous set, whose pins may no longer be owned */
+    Port_ClearDriftCounters();
+#endif
+
+    /* Ports getting their first configured pins need their clock */
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        if ((Port_PortImage[port].ownedMask == 0) && (Delta->toImages[port].ownedMask != 0))
+        {
+            clockMask |= (uint8)(1U << port);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+        Port_PortImage[port] = Delta->toImages[port];
+    }
+    (void)Port_EnableClocks(clockMask & Port_PortInitMask);
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        if ((clockMask & Port_PortInitMask & (1U << port)) != 0)
+        {
+            Port_LoadShadowRegisters(port);
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+#endif
+    Port_BuildPinBitmaps(ConfigPtr);
+#if (PORT_VERIFY_CONFIGURATION_API == STD_ON)
+    Port_BuildVerifyImages();
+#endif
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        const Port_PortDeltaType *delta = &Delta->ports[port];
+        uint32 base = Port_BaseAddress[port];
+
+        /* Ports left to Port_InitPort get the new images when they are initialized */
+        if ((Port_PortInitMask & (1U << port)) == 0)
+        {
+            continue;
+        }
+
+        /* If PD7 or PF0 become configured, then we need to unlock and commit */
+        if (delta->commitMask != 0)
+        {
+            PORT_WRITE_REG(base + PORT_LOCK_REG_OFFSET, PORT_UNLOCK_VALUE);
+            Port_WriteRegisterBits(port, PORT_REG_COMMIT, delta->commitMask, delta->commitMask);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        /* Same order as Port_Init: pin functions first, then initial levels before directions */
+        Port_WriteChangedBits(port, PORT_REG_AMSEL, delta->amselMask, delta->amsel);
+        Port_WriteChangedBits(port, PORT_REG_PCTL, delta->pctlMask, delta->pctl);
+        Port_WriteChangedBits(port, PORT_REG_AFSEL, delta->afselMask, delta->afsel);
+        Port_WriteChangedBits(port, PORT_REG_PUR, delta->purMask, delta->pur);
+        Port_WriteChangedBits(port, PORT_REG_PDR, delta->pdrMask, delta->pdr);
+        Port_WriteChangedBits(port, PORT_REG_DEN, delta->denMask, delta->den);
+        Port_WriteChangedBits(port, PORT_REG_DATA, delta->dataMask, delta->data);
+        Port_WriteChangedBits(port, PORT_REG_DIR, delta->dirMask, delta->dir);
+    }
+
+    Port_ConfigPtr = ConfigPtr;
+}
+#endif
+
+/************************************************************************************
+ * Service Name: Port_GetInstrumentation
+ * Service ID[hex]: 0x0B
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): Snapshot - Call statistics of the instrumented APIs
+ * Return value: None
+ * Description: Returns a snapshot of the call counts and cycle statistics of Port_Init,
+ *              Port_SetPinDirection, Port_SetPinMode and Port_RefreshPortDirection.
+ ************************************************************************************/
+#if (PORT_INSTRUMENTATION == STD_ON)
+void Port_GetInstrumentation(Port_InstrumentationType *Snapshot)
+{
+    uint8 apiId;
+
+    /************************************************ DET Error checks ****************************************/
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Check if input pointer is not Null pointer */
+    if (NULL_PTR == Snapshot)
+    {
+        /* Report to DET  */
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_INSTRUMENTATION_SID, PORT_E_PARAM_POINTER);
+    }
+    else
+#endif
+    {
+        *Snapshot = Port_Instrumentation;
+        for (apiId = PORT_INIT_SID; apiId < PORT_INSTRUMENTED_SIDS; apiId++)
+        {
+            if (Snapshot->api[apiId].calls != 0)
+            {
+                Snapshot->api[apiId].avgCycles = (uint32)(Snapshot->api[apiId].totalCycles / Snapshot->api[apiId].calls);
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+        }
+    }
+}
+#endif
+
+#if (PORT_INIT_IMAGE_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_IsImageValid
+ * Parameters (in): ImagePtr - Pointer to a post-build configuration image.
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: TRUE if the image is intact, built for this driver version and its pins can be used
+ * Description: Checks the header of the image, then its CRC, then the modes of its port defaults and
+ *              last that every pin in use exists, is listed once and supports its mode.
+ ************************************************************************************/
+STATIC boolean Port_IsImageValid(const Port_ImageHeaderType *ImagePtr)
+{
+    if ((ImagePtr->magic != PORT_IMAGE_MAGIC) ||
+        (ImagePtr->arMajorVersion != PORT_AR_RELEASE_MAJOR_VERSION) || (ImagePtr->arMinorVersion != PORT_AR_RELEASE_MINOR_VERSION) || (ImagePtr->arPatchVersion != PORT_AR_RELEASE_PATCH_VERSION) ||
+        (ImagePtr->swMajorVersion != PORT_SW_MAJOR_VERSION) || (ImagePtr->swMinorVersion != PORT_SW_MINOR_VERSION) || (ImagePtr->swPatchVersion != PORT_SW_PATCH_VERSION))
+    {
+        return FALSE;
+    }
+    /* The length is checked before the CRC is computed over it */
+    else if ((ImagePtr->numberOfPins > PORT_NUMBER_OF_PINS) ||
+             (ImagePtr->length != ((PORT_NUMBER_OF_PORTS + ImagePtr->numberOfPins) * sizeof(Port_ConfigSinglePinType))))
+    {
+        return FALSE;
+    }
+    else if (ImagePtr->crc != Port_ImageCrc32((const uint8 *)ImagePtr + PORT_IMAGE_CRC_OFFSET,
+                                              (sizeof(Port_ImageHeaderType) - PORT_IMAGE_CRC_OFFSET) + ImagePtr->length))
+    {
+        return FALSE;
+    }
+    /* The port defaults come first in the table right after the header */
+    else if (Port_AreDefaultsValid((const Port_ConfigSinglePinType *)(ImagePtr + 1)) == FALSE)
+    {
+        return FALSE;
+    }
+    /* A valid CRC only shows the image arrived intact, its pins are checked whatever the DET setting */
+    else if (Port_ArePinsValid((const Port_ConfigSinglePinType *)(ImagePtr + 1) + PORT_NUMBER_OF_PORTS, ImagePtr->numberOfPins) == FALSE)
+    {
+        return FALSE;
+    }
+    else
+    {
+        return TRUE;
+    }
+}
+
+/************************************************************************************
+ * Service Name: Port_InitImage
+ * Service ID[hex]: 0x0C
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): ImagePtr - Pointer to a post-build configuration image, 4-byte aligned.
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Std_ReturnType - E_OK if the module was initialized from the image
+ * Description: Checks a post-build configuration image and initializes the Port Driver module
+ *              from it. The pin table is used in place, so the image must stay mapped while
+ *              the module is initialized.
+ ************************************************************************************/
+Std_ReturnType Port_InitImage(const Port_ImageHeaderType *ImagePtr)
+{
+    const Port_ConfigSinglePinType *table;
+    Port_ConfigType imageConfig;
+    uint8 port;
+
+    PORT_TRACE_CONTEXT(PORT_INIT_IMAGE_SID, PORT_TRACE_NO_PIN);
+
+    /************************************************ DET Errors Check ****************************************/
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Null image pointer DET error */
+    if (NULL_PTR == ImagePtr)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_IMAGE_SID, PORT_E_PARAM_POINTER);
+        return E_NOT_OK;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+
+    /* A corrupted image or one built for another driver version is never used */
+    if (Port_IsImageValid(ImagePtr) == FALSE)
+    {
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_IMAGE_SID, PORT_E_INIT_FAILED);
+#endif
+        return E_NOT_OK;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    /* The port defaults are followed by the pins in use right after the header */
+    table = (const Port_ConfigSinglePinType *)(ImagePtr + 1);
+    imageConfig.pinConfig = &table[PORT_NUMBER_OF_PORTS];
+    imageConfig.numberOfPins = ImagePtr->numberOfPins;
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        imageConfig.portDefault[port] = table[port];
+    }
+    imageConfig.earlyPorts = ImagePtr->earlyPorts;
+
+    Port_ImageConfig = imageConfig;
+    Port_Init(&Port_ImageConfig);
+
+    return E_OK;
+}
+#endif
+
+#if (PORT_UPDATE_TRANSACTION_API == STD_ON)
+/************************************************************************************
+ * Service Name: Port_BeginUpdate
+ * Service ID[hex]: 0x0D
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Starts an update. Until Port_CommitUpdate the direction and mode APIs only stage
+ *              their changes in RAM shadows of the DIR, AFSEL, DEN, AMSEL and PCTL registers.
+ ************************************************************************************/
+void Port_BeginUpdate(void)
+{
+    /************************************************ DET Errors Check ****************************************/
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* Port status uninitialized DET error */
+    if (Port_Status == PORT_NOT_INITIALIZED)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_BEGIN_UPDATE_SID, PORT_E_UNINIT);
+        return;
+    }
+    /* Update already started DET error */
+    else if (Port_UpdateActive == TRUE)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_BEGIN_UPDATE_SID, PORT_E_UPDATE_SEQUENCE);
+        return;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+#endif
+
+    Port_ClearUpdate();
+    Port_UpdateActive = TRUE;
+}
+
+/************************************************************************************
+ * Service Name: Port_CommitUpdate
+ * Service ID[hex]: 0x0E
+ * Sync/Async: Synchronous
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Ends an update and writes the staged changes. Each dirty register of a port is
+ *              read once, so N pin changes cost at most one read and two writes per register.
+ *              The order keeps every pin glitch free: pins stop driving and leave their digital
+ *              or alternate function first, the analog and PMCx selections change while nothing
+ *              is connected, then the new functions and output drivers are turned on.
  ************************************************************************************/
-void Port_Init(const Port_ConfigType *ConfigPtr)
+void Port_CommitUpdate(void)
 {
+    uint8 port;
+
+    PORT_TRACE_CONTEXT(PORT_COMMIT_UPDATE_SID, PORT_TRACE_NO_PIN);
 
+    /************************************************ DET Errors Check ****************************************/
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
-    /* check if the input configuration pointer is not a NULL_PTR */
-    if (NULL_PTR == ConfigPtr)
+    /* Port status uninitialized DET error */
+    if (Port_Status == PORT_NOT_INITIALIZED)
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_INIT_SID, PORT_E_INIT_FAILED);
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_COMMIT_UPDATE_SID, PORT_E_UNINIT);
+        return;
+    }
+    /* Update not started DET error */
+    else if (Port_UpdateActive == FALSE)
+    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_COMMIT_UPDATE_SID, PORT_E_UPDATE_SEQUENCE);
+        return;
     }
     else
-#endif
     {
-        /*
-         * Set the module state to initialized and point to the PB configuration structure using a global pointer.
-         * This global pointer is global to be used by other functions to read the PB configuration structures
-         */
-        Port_Status = PORT_INITIALIZED;
-        Port_ConfigPtr = ConfigPtr; /* address of the first pinConfig structure --> pinConfig[0] */
+        /* Do nothing */
     }
-    volatile uint32 delay = 0;
+#endif
 
-    Port_PinType index;
-    for (index = PA0; index < PORT_NUMBER_OF_PINS; index++)
+    Port_UpdateActive = FALSE;
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
     {
-        /* point to the required Port Registers base address */
-        volatile uint32 *Port_Ptr = NULL_PTR;
-        switch (Port_ConfigPtr->pinConfig[index].portNumber)
-        {
-        case PORT_PortA:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS;
-            break;
-        case PORT_PortB:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS;
-            break;
-        case PORT_PortC:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS;
-            break;
-        case PORT_PortD:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS;
-            break;
-        case PORT_PortE:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS;
-            break;
-        case PORT_PortF:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS;
-            break;
-        }
-
-        /* Open clock for the required port */
-        SYSCTL_REGCGC2_REG |= (1 << Port_ConfigPtr->pinConfig[index].portNumber);
-        delay = SYSCTL_REGCGC2_REG;
-
-        /************************************************ Checking for special pins (PD7,PF0,PC0-PC3) ****************************************/
-        /* If PC0-PC3, then do nothing (JTAG Pins) */
-        if (((Port_ConfigPtr->pinConfig[index].portNumber == PORT_PortC) && (Port_ConfigPtr->pinConfig[index].pinNumber <= PORT_Pin3)))
+        const Port_PortDeltaType *shadow = &Port_UpdateShadow[port];
+        uint32 dir = 0;
+        uint32 afsel = 0;
+        uint32 den = 0;
+
+        /* Release: outputs becoming inputs, pins leaving their alternate function and digital pins becoming analog */
+        if (shadow->dirMask != 0)
         {
-            continue;
+            dir = Port_CommitRelease(port, PORT_REG_DIR, shadow->dirMask, shadow->dir);
         }
-        /* If PD7 or PF0, then we need to unlock and commit */
-        else if (((Port_ConfigPtr->pinConfig[index].portNumber == PORT_PortD) && (Port_ConfigPtr->pinConfig[index].pinNumber == PORT_Pin7)) || ((Port_ConfigPtr->pinConfig[index].portNumber == PORT_PortF) && (Port_ConfigPtr->pinConfig[index].pinNumber == PORT_Pin0)))
+        else
         {
-            /* Unlock port */
-            *(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_LOCK_REG_OFFSET) = 0x4C4F434B;
-
-            /* Set the required bit in commit register according to the pin */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_COMMIT_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
+            /* Do Nothing */
+        }
+        if (shadow->afselMask != 0)
+        {
+            afsel = Port_CommitRelease(port, PORT_REG_AFSEL, shadow->afselMask, shadow->afsel);
         }
         else
         {
             /* Do Nothing */
         }
-
-        /************************************************ Configuring the pin direction ****************************************/
-        /* If pin direction is output */
-        if (Port_ConfigPtr->pinConfig[index].direction == PORT_PIN_OUT)
+        if (shadow->denMask != 0)
         {
-            /* Set corresponding pin in the port direction register */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIR_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
-
-            /* If initial value is high */
-            if (Port_ConfigPtr->pinConfig[index].initialValue == PORT_PIN_LEVEL_HIGH)
-            {
-                /* Set corresponding pin in the port data register */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DATA_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
-            }
-            /* If initial value is low */
-            else
-            {
-                /* Clear corresponding pin in the port data register */
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DATA_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
-            }
+            den = Port_CommitRelease(port, PORT_REG_DEN, shadow->denMask, shadow->den);
         }
-        /* If pin direction is input */
-        else if (Port_ConfigPtr->pinConfig[index].direction == PORT_PIN_IN)
+        else
         {
-            /* Clear corresponding pin in the port direction register */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIR_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
+            /* Do Nothing */
+        }
 
-            /* If internal resistor is set to pull up */
-            if (Port_ConfigPtr->pinConfig[index].internalResistor == PULL_UP)
-            {
-                /* Set corresponding bit in Pull up register */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_PULL_UP_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
-            }
-            /* If internal resistor is set to pull up */
-            else if (Port_ConfigPtr->pinConfig[index].internalResistor == PULL_DOWN)
-            {
-                /* Set corresponding bit in Pull down register */
-                SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_PULL_DOWN_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
-            }
-            /* If internal resistor is disabled */
-            else
-            {
-                /* Clear both corresponding bits in the pull up and pull down registers */
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_PULL_UP_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
-                CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_PULL_DOWN_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
-            }
+        /* Switch: analog mode and PMCx fields */
+        Port_WriteChangedBits(port, PORT_REG_AMSEL, shadow->amselMask, shadow->amsel);
+        Port_WriteChangedBits(port, PORT_REG_PCTL, shadow->pctlMask, shadow->pctl);
+
+        /* Engage: digital pins, alternate functions and last the output drivers */
+        if (shadow->denMask != 0)
+        {
+            Port_CommitEngage(port, PORT_REG_DEN, den, shadow->denMask, shadow->den);
         }
         else
         {
-            /* Do nothing */
+            /* Do Nothing */
         }
-
-        /************************************************ Configuring the pin mode ****************************************/
-        /* ADC Mode */
-        if (Port_ConfigPtr->pinConfig[index].mode == ADC_MODE)
+        if (shadow->afselMask != 0)
         {
-            /* Clear corresponding bit in the digital enable register */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
-
-            /* Set corresponding bit in the analog mode select register */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
+            Port_CommitEngage(port, PORT_REG_AFSEL, afsel, shadow->afselMask, shadow->afsel);
         }
-        /* Digital Mode */
         else
         {
-            /* Set corresponding bit in the digital enable register */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
-
-            /* Clear corresponding bit in the analog mode select register */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
+            /* Do Nothing */
         }
-
-        /* If mode is DIO */
-        if (Port_ConfigPtr->pinConfig[index].mode == GPIO_MODE)
+        if (shadow->dirMask != 0)
         {
-            /* Clear corresponding bit in the alternate function register */
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
-
-            /* Clear PMCx bits in port control register */
-            *(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_CTL_REG_OFFSET) &= ~(PMCx_BITS_MASK << (Port_ConfigPtr->pinConfig[index].pinNumber * 4));
+            Port_CommitEngage(port, PORT_REG_DIR, dir, shadow->dirMask, shadow->dir);
         }
-        /* If alternate (Not DIO) */
         else
         {
-            /* Set corresponding bit in the alternate function register */
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
-
-            /* Set PMCx bits in port control register according to the required mode */
-            *(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_CTL_REG_OFFSET) |= ((Port_ConfigPtr->pinConfig[index].mode & PMCx_BITS_MASK) << (Port_ConfigPtr->pinConfig[index].pinNumber * 4));
+            /* Do Nothing */
         }
     }
+
+    /* A commit without a new Port_BeginUpdate has nothing to write */
+    Port_ClearUpdate();
 }
+#endif
 
+#if (PORT_SHADOW_REGISTERS == STD_ON)
 /************************************************************************************
- * Service Name: Port_SetPinDirection
- * Service ID[hex]: 0x01
+ * Service Name: Port_ResyncShadowRegisters
+ * Service ID[hex]: 0x0F
  * Sync/Async: Synchronous
- * Reentrancy: Reentrant
- * Parameters (in): Pin - Port Pin ID number, Direction - Port Pin Direction
+ * Reentrancy: Non reentrant
+ * Parameters (in): None
  * Parameters (inout): None
  * Parameters (out): None
  * Return value: None
- * Description: Sets the port pin direction.
+ * Description: Reloads the register shadows of every initialized port from the hardware, to be
+ *              called after the configuration registers were written outside the Port Driver.
  ************************************************************************************/
-#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
-void Port_SetPinDirection(Port_PinType Pin, Port_PinDirectionType Direction)
+void Port_ResyncShadowRegisters(void)
 {
+    uint8 port;
+
+    PORT_TRACE_CONTEXT(PORT_RESYNC_SHADOW_REGISTERS_SID, PORT_TRACE_NO_PIN);
+
     /************************************************ DET Errors Check ****************************************/
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
     /* Port status uninitialized DET error */
     if (Port_Status == PORT_NOT_INITIALIZED)
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_SID, PORT_E_UNINIT);
-    }
-    else
-    {
-        /* Do nothing */
-    }
-    /* Invalid port pin number DET error */
-    if (Port_ConfigPtr->pinConfig[Pin].pinNumber < 0 || Port_ConfigPtr->pinConfig[Pin].pinNumber >= PORT_NUMBER_OF_PINS)
-    {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_SID, PORT_E_PARAM_PIN);
-    }
-    else
-    {
-        /* Do nothing */
-    }
-    /* Direction of the pin is configured unchangeable DET error */
-    if (Port_ConfigPtr->pinConfig[Pin].isDirectionChangeable == STD_OFF)
-    {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_DIRECTION_SID, PORT_E_DIRECTION_UNCHANGEABLE);
-    }
-    else
-    {
-        /* Do nothing */
-    }
-#endif
-
-    /************************************************ JTAG Pins Check ****************************************/
-    if ((Port_ConfigPtr->pinConfig[Pin].portNumber == PORT_PortC) && (Port_ConfigPtr->pinConfig[Pin].pinNumber <= PORT_Pin3))
-    {
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_RESYNC_SHADOW_REGISTERS_SID, PORT_E_UNINIT);
         return;
     }
     else
     {
         /* Do nothing */
     }
-    /* Point to the required Port Register base address */
-    volatile uint32 *Port_Ptr = NULL_PTR;
-    switch (Port_ConfigPtr->pinConfig[Pin].portNumber)
-    {
-    case PORT_PortA:
-        Port_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS;
-        break;
-    case PORT_PortB:
-        Port_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS;
-        break;
-    case PORT_PortC:
-        Port_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS;
-        break;
-    case PORT_PortD:
-        Port_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS;
-        break;
-    case PORT_PortE:
-        Port_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS;
-        break;
-    case PORT_PortF:
-        Port_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS;
-        break;
-    }
+#endif
 
-    if (Direction == PORT_PIN_OUT)
-    {
-        /* Set corresponding pin in the port direction register */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIR_REG_OFFSET), Port_ConfigPtr->pinConfig[Pin].pinNumber);
-    }
-    else if (Direction == PORT_PIN_IN)
-    {
-        /* Clear corresponding pin in the port direction register */
-        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIR_REG_OFFSET), Port_ConfigPtr->pinConfig[Pin].pinNumber);
-    }
-    else
+    /* Ports without configured pins stay gated and have no shadows */
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
     {
-        /* Do nothing */
+        if (((Port_PortInitMask & (1U << port)) != 0) && (Port_PortImage[port].ownedMask != 0))
+        {
+            Port_LoadShadowRegisters(port);
+        }
+        else
+        {
+            /* Do nothing */
+        }
     }
 }
 #endif
 
+#if (PORT_VERIFY_CONFIGURATION_API == STD_ON)
 /************************************************************************************
- * Service Name: Port_RefreshPortDirection
- * Service ID[hex]: 0x02
+ * Service Name: Port_VerifyConfiguration
+ * Service ID[hex]: 0x10
  * Sync/Async: Synchronous
- * Reentrancy: Non Reentrant
+ * Reentrancy: Reentrant
  * Parameters (in): None
  * Parameters (inout): None
  * Parameters (out): None
- * Return value: None
- * Description: Refreshes port direction.
+ * Return value: Bitmap of the mismatching registers, PORT_VERIFY_MISMATCH_BIT of each register that
+ *               differs from the configuration set, PORT_VERIFY_ALL_REGISTERS if the driver is not initialized.
+ * Description: Reads DIR, AFSEL, PUR, PDR, DEN, AMSEL and PCTL of every initialized port and compares
+ *              them with the values expected since Port_Init. The hardware is read even with register
+ *              shadows, the direction and mode of the changeable pins are not checked.
  ************************************************************************************/
-void Port_RefreshPortDirection(void)
+uint64 Port_VerifyConfiguration(void)
 {
-    /************************************************ DET Error checks ****************************************/
-#if (PORT_DEV_ERROR_DETECT == STD_ON)
-    /* Port status uninitialized DET error */
+    uint64 mismatch = 0;
+    uint8 port;
+
+    PORT_TRACE_CONTEXT(PORT_VERIFY_CONFIGURATION_SID, PORT_TRACE_NO_PIN);
+
     if (Port_Status == PORT_NOT_INITIALIZED)
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_REFRESH_PORT_DIRECTION_SID, PORT_E_UNINIT);
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_VERIFY_CONFIGURATION_SID, PORT_E_UNINIT);
+#endif
+        return PORT_VERIFY_ALL_REGISTERS;
     }
     else
     {
-        /* Do Nothing */
+        /* Do nothing */
     }
-#endif
-    Port_PinType index;
-    for (index = PA0; index < PORT_NUMBER_OF_PINS; index++)
+
+    /* Ports without configured pins stay gated and are not read */
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
     {
-        /* point to the required Port Registers base address */
-        volatile uint32 *Port_Ptr = NULL_PTR;
-        switch (Port_ConfigPtr->pinConfig[index].portNumber)
-        {
-        case PORT_PortA:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS;
-            break;
-        case PORT_PortB:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS;
-            break;
-        case PORT_PortC:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS;
-            break;
-        case PORT_PortD:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS;
-            break;
-        case PORT_PortE:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS;
-            break;
-        case PORT_PortF:
-            Port_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS;
-            break;
-        }
-
-        /************************************************ Checking for special pins (PD7,PF0,PC0-PC3) ****************************************/
-        /* If PC0-PC3, then do nothing (JTAG Pins) */
-        if (((Port_ConfigPtr->pinConfig[index].portNumber == PORT_PortC) && (Port_ConfigPtr->pinConfig[index].pinNumber <= PORT_Pin3)))
+        const Port_VerifyImageType *verify = &Port_VerifyImage[port];
+        uint32 base = Port_BaseAddress[port];
+        uint64 registers;
+        uint64 difference;
+        uint32 pctlDifference;
+        uint8 reg;
+
+        if (((Port_PortInitMask & (1U << port)) == 0) || (Port_PortImage[port].ownedMask == 0))
         {
             continue;
         }
-
-        /************************************************ Configuring the pin direction ****************************************/
-        /* If pin direction is input */
-        if (Port_ConfigPtr->pinConfig[index].direction == PORT_PIN_IN)
+        else
         {
-            CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIR_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
+            /* Do nothing */
         }
-        /* If pin direction is output */
-        else if (Port_ConfigPtr->pinConfig[index].direction == PORT_PIN_OUT)
+
+        /* The 8-bit registers are compared at once as one packed word */
+        registers = PORT_VERIFY_LANE(PORT_VERIFY_DIR, PORT_READ_REG(base + PORT_DIR_REG_OFFSET)) |
+                    PORT_VERIFY_LANE(PORT_VERIFY_AFSEL, PORT_READ_REG(base + PORT_ALT_FUNC_REG_OFFSET)) |
+                    PORT_VERIFY_LANE(PORT_VERIFY_PUR, PORT_READ_REG(base + PORT_PULL_UP_REG_OFFSET)) |
+                    PORT_VERIFY_LANE(PORT_VERIFY_PDR, PORT_READ_REG(base + PORT_PULL_DOWN_REG_OFFSET)) |
+                    PORT_VERIFY_LANE(PORT_VERIFY_DEN, PORT_READ_REG(base + PORT_DIGITAL_ENABLE_REG_OFFSET)) |
+                    PORT_VERIFY_LANE(PORT_VERIFY_AMSEL, PORT_READ_REG(base + PORT_ANALOG_MODE_SEL_REG_OFFSET));
+        difference = (registers ^ verify->expected) & verify->mask;
+        pctlDifference = (PORT_READ_REG(base + PORT_CTL_REG_OFFSET) ^ verify->pctl) & verify->pctlMask;
+
+        /* Only a mismatching port is broken down to its registers */
+        if ((difference != 0) || (pctlDifference != 0))
         {
-            SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIR_REG_OFFSET), Port_ConfigPtr->pinConfig[index].pinNumber);
+            for (reg = PORT_VERIFY_DIR; reg < PORT_VERIFY_PCTL; reg++)
+            {
+                if ((uint8)(difference >> (reg * 8U)) != 0)
+                {
+                    mismatch |= PORT_VERIFY_MISMATCH_BIT(port, reg);
+                }
+                else
+                {
+                    /* Do nothing */
+                }
+            }
+            if (pctlDifference != 0)
+            {
+                mismatch |= PORT_VERIFY_MISMATCH_BIT(port, PORT_VERIFY_PCTL);
+            }
+            else
+            {
+                /* Do nothing */
+            }
         }
         else
         {
-            /* Do Nothing */
+            /* Do nothing */
         }
     }
+
+    return mismatch;
 }
+#endif
 
+#if (PORT_SNAPSHOT_API == STD_ON)
 /************************************************************************************
- * Service Name: Port_GetVersionInfo
- * Service ID[hex]: 0x03
+ * Service Name: Port_Snapshot
+ * Service ID[hex]: 0x11
  * Sync/Async: Synchronous
  * Reentrancy: Reentrant
  * Parameters (in): None
  * Parameters (inout): None
- * Parameters (out): versioninfo - Pointer to where to store the version information of this module.
+ * Parameters (out): Snapshot - Captured GPIO registers
  * Return value: None
- * Description: Returns the version information of this module.
+ * Description: Captures DATA, DIR, AFSEL, PUR, PDR, DEN, CR, AMSEL and PCTL of every clocked port
+ *              in one pass in address order, each port through the aperture it is mapped to.
+ *              It does not need Port_Init and never writes a register, so it can be called from
+ *              a fault handler. At most 2 + 9 reads per port are done.
  ************************************************************************************/
-#if (PORT_VERSION_INFO_API == STD_ON)
-void Port_GetVersionInfo(Std_VersionInfoType *versioninfo)
+void Port_Snapshot(Port_SnapshotType *Snapshot)
 {
-    /************************************************ DET Error checks ****************************************/
+    uint32 ready;
+    uint32 ahb;
+    uint8 port;
+
+    PORT_TRACE_CONTEXT(PORT_SNAPSHOT_SID, PORT_TRACE_NO_PIN);
+
+    /************************************************ DET Errors Check ****************************************/
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
-    /* Check if input pointer is not Null pointer */
-    if (NULL_PTR == versioninfo)
+    /* Null snapshot pointer DET error */
+    if (NULL_PTR == Snapshot)
     {
-        /* Report to DET  */
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_GET_VERSION_INFO_SID, PORT_E_PARAM_POINTER);
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SNAPSHOT_SID, PORT_E_PARAM_POINTER);
+        return;
     }
     else
+    {
+        /* Do nothing */
+    }
 #endif
+
+    /* Gated ports would fault, only the ready ones are read */
+    ready = PORT_READ_REG(SYSCTL_PRGPIO_REG_ADDRESS) & PORT_ALL_PORTS_MASK;
+    ahb = PORT_READ_REG(SYSCTL_GPIOHBCTL_REG_ADDRESS);
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
     {
-        /* Copy the vendor Id */
-        versioninfo->vendorID = (uint16)PORT_VENDOR_ID;
-        /* Copy the module Id */
-        versioninfo->moduleID = (uint16)PORT_MODULE_ID;
-        /* Copy Software Major Version */
-        versioninfo->sw_major_version = (uint8)PORT_SW_MAJOR_VERSION;
-        /* Copy Software Minor Version */
-        versioninfo->sw_minor_version = (uint8)PORT_SW_MINOR_VERSION;
-        /* Copy Software Patch Version */
-        versioninfo->sw_patch_version = (uint8)PORT_SW_PATCH_VERSION;
+        Port_PortSnapshotType *capture = &Snapshot->ports[port];
+
+        if ((ready & (1U << port)) != 0)
+        {
+            uint32 base = Port_ApertureBaseAddress[(ahb >> port) & 1U][port];
+
+            capture->data = (uint8)PORT_READ_REG(base + PORT_DATA_REG_OFFSET);
+            capture->dir = (uint8)PORT_READ_REG(base + PORT_DIR_REG_OFFSET);
+            capture->afsel = (uint8)PORT_READ_REG(base + PORT_ALT_FUNC_REG_OFFSET);
+            capture->pur = (uint8)PORT_READ_REG(base + PORT_PULL_UP_REG_OFFSET);
+            capture->pdr = (uint8)PORT_READ_REG(base + PORT_PULL_DOWN_REG_OFFSET);
+            capture->den = (uint8)PORT_READ_REG(base + PORT_DIGITAL_ENABLE_REG_OFFSET);
+            capture->cr = (uint8)PORT_READ_REG(base + PORT_COMMIT_REG_OFFSET);
+            capture->amsel = (uint8)PORT_READ_REG(base + PORT_ANALOG_MODE_SEL_REG_OFFSET);
+            capture->pctl = PORT_READ_REG(base + PORT_CTL_REG_OFFSET);
+        }
+        else
+        {
+            capture->data = 0;
+            capture->dir = 0;
+            capture->afsel = 0;
+            capture->pur = 0;
+            capture->pdr = 0;
+            capture->den = 0;
+            capture->cr = 0;
+            capture->amsel = 0;
+            capture->pctl = 0;
+        }
     }
+    Snapshot->portMask = (uint8)ready;
+    Snapshot->reserved[0] = 0;
+    Snapshot->reserved[1] = 0;
+    Snapshot->reserved[2] = 0;
 }
-#endif
 
 /************************************************************************************
- * Service Name: Port_SetPinMode
- * Service ID[hex]: 0x04
+ * Service Name: Port_DiffSnapshots
+ * Service ID[hex]: 0x12
  * Sync/Async: Synchronous
  * Reentrancy: Reentrant
- * Parameters (in): Pin - Port Pin ID number, Mode - New Port Pin mode to be set on port pin
+ * Parameters (in): Before - Older snapshot, After - Newer snapshot
  * Parameters (inout): None
- * Parameters (out): versioninfo - Pointer to where to store the version information of this module.
- * Return value: None
- * Description: Sets the port pin mode.
+ * Parameters (out): Changes - Register bits that differ between the snapshots
+ * Return value: Ports with differing bits or captured in only one snapshot, one bit per port number
+ * Description: Compares two snapshots of Port_Snapshot without touching the hardware. Every register
+ *              of Changes holds the XOR of the two captures, the portMask of Changes is the return value.
  ************************************************************************************/
-#if (PORT_SET_PIN_MODE_API == STD_ON)
-void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
+uint8 Port_DiffSnapshots(const Port_SnapshotType *Before, const Port_SnapshotType *After, Port_SnapshotType *Changes)
 {
+    uint8 changedPorts;
+    uint8 port;
+
     /************************************************ DET Errors Check ****************************************/
 #if (PORT_DEV_ERROR_DETECT == STD_ON)
-    /* Port status uninitialized DET error */
-    if (Port_Status == PORT_NOT_INITIALIZED)
-    {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_UNINIT);
-    }
-    else
-    {
-        /* Do nothing */
-    }
-    /* Invalid port pin number DET error */
-    if (Port_ConfigPtr->pinConfig[Pin].pinNumber < 0 || Port_ConfigPtr->pinConfig[Pin].pinNumber >= PORT_NUMBER_OF_PINS)
-    {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
-    }
-    else
-    {
-        /* Do nothing */
-    }
-    /* Mode of the pin is configured unchangeable DET error */
-    if (Port_ConfigPtr->pinConfig[Pin].isModeChangeable == STD_OFF)
+    /* Null snapshot pointer DET error */
+    if ((NULL_PTR == Before) || (NULL_PTR == After) || (NULL_PTR == Changes))
     {
-        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_MODE_UNCHANGEABLE);
+        Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_DIFF_SNAPSHOTS_SID, PORT_E_PARAM_POINTER);
+        return 0;
     }
     else
     {
@@ -456,76 +2731,39 @@ void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode)
     }
 #endif
 
-    /************************************************ JTAG Pins Check ****************************************/
-    if ((Port_ConfigPtr->pinConfig[Pin].portNumber == PORT_PortC) && (Port_ConfigPtr->pinConfig[Pin].pinNumber <= PORT_Pin3))
-    {
-        return;
-    }
-    else
-    {
-        /* Do nothing */
-    }
-
-    volatile uint32 *Port_Ptr = NULL_PTR;
-    switch (Port_ConfigPtr->pinConfig[Pin].portNumber)
-    {
-    case PORT_PortA:
-        Port_Ptr = (volatile uint32 *)GPIO_PORTA_BASE_ADDRESS;
-        break;
-    case PORT_PortB:
-        Port_Ptr = (volatile uint32 *)GPIO_PORTB_BASE_ADDRESS;
-        break;
-    case PORT_PortC:
-        Port_Ptr = (volatile uint32 *)GPIO_PORTC_BASE_ADDRESS;
-        break;
-    case PORT_PortD:
-        Port_Ptr = (volatile uint32 *)GPIO_PORTD_BASE_ADDRESS;
-        break;
-    case PORT_PortE:
-        Port_Ptr = (volatile uint32 *)GPIO_PORTE_BASE_ADDRESS;
-        break;
-    case PORT_PortF:
-        Port_Ptr = (volatile uint32 *)GPIO_PORTF_BASE_ADDRESS;
-        break;
-    }
-
-    /* ADC Mode */
-    if (Mode == ADC_MODE)
-    {
-        /* Clear corresponding bit in the digital enable register */
-        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), Port_ConfigPtr->pinConfig[Pin].pinNumber);
+    changedPorts = Before->portMask ^ After->portMask;
 
-        /* Set corresponding bit in the analog mode select register */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_ConfigPtr->pinConfig[Pin].pinNumber);
-    }
-    /* Digital Mode */
-    else
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
     {
-        /* Set corresponding bit in the digital enable register */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_DIGITAL_ENABLE_REG_OFFSET), Port_ConfigPtr->pinConfig[Pin].pinNumber);
+        const Port_PortSnapshotType *before = &Before->ports[port];
+        const Port_PortSnapshotType *after = &After->ports[port];
+        Port_PortSnapshotType *changes = &Changes->ports[port];
 
-        /* Clear corresponding bit in the analog mode select register */
-        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_ANALOG_MODE_SEL_REG_OFFSET), Port_ConfigPtr->pinConfig[Pin].pinNumber);
-    }
-
-    /* If mode is DIO */
-    if (Mode == GPIO_MODE)
-    {
-        /* Clear corresponding bit in the alternate function register */
-        CLEAR_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_ConfigPtr->pinConfig[Pin].pinNumber);
+        changes->data = before->data ^ after->data;
+        changes->dir = before->dir ^ after->dir;
+        changes->afsel = before->afsel ^ after->afsel;
+        changes->pur = before->pur ^ after->pur;
+        changes->pdr = before->pdr ^ after->pdr;
+        changes->den = before->den ^ after->den;
+        changes->cr = before->cr ^ after->cr;
+        changes->amsel = before->amsel ^ after->amsel;
+        changes->pctl = before->pctl ^ after->pctl;
 
-        /* Clear PMCx bits in port control register */
-        *(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_CTL_REG_OFFSET) &= ~(PMCx_BITS_MASK << (Port_ConfigPtr->pinConfig[Pin].pinNumber * 4));
+        if ((changes->pctl | changes->data | changes->dir | changes->afsel | changes->pur |
+             changes->pdr | changes->den | changes->cr | changes->amsel) != 0)
+        {
+            changedPorts |= (uint8)(1U << port);
+        }
+        else
+        {
+            /* Do nothing */
+        }
     }
-    /* If alternate (Not DIO) */
-    else
-    {
-        /* Set corresponding bit in the alternate function register */
-        SET_BIT(*(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_ALT_FUNC_REG_OFFSET), Port_ConfigPtr->pinConfig[Pin].pinNumber);
+    Changes->portMask = changedPorts;
+    Changes->reserved[0] = 0;
+    Changes->reserved[1] = 0;
+    Changes->reserved[2] = 0;
 
-        /* Clear all the PMCx bits then set them in port control register according to the required mode */
-        *(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_CTL_REG_OFFSET) &= ~(PMCx_BITS_MASK << (Port_ConfigPtr->pinConfig[Pin].pinNumber * 4));
-        *(volatile uint32 *)((volatile uint8 *)Port_Ptr + PORT_CTL_REG_OFFSET) |= ((Mode & PMCx_BITS_MASK) << (Port_ConfigPtr->pinConfig[Pin].pinNumber * 4));
-    }
+    return changedPorts;
 }
-#endif
\ No newline at end of file
+#endif
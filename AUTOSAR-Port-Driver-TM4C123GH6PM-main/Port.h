@@ -16,7 +16,7 @@
 #define PORT_VENDOR_ID (1000U)
 
 /* Port Module Id */
-#define PORT_MODULE_ID (120U)
+#define PORT_MODULE_ID (124U)
 
 /* Port Instance Id */
 #define PORT_INSTANCE_ID (0U)
@@ -83,6 +83,48 @@
 /* Service ID for Port Set Pin Mode */
 #define PORT_SET_PIN_MODE_SID (uint8)0x04
 
+/* Service ID for Port Get Init Statistics */
+#define PORT_GET_INIT_STATISTICS_SID (uint8)0x05
+
+/* Service ID for Port Set Port Pins Direction */
+#define PORT_SET_PORT_PINS_DIRECTION_SID (uint8)0x06
+
+/* Service ID for Port Set Port Pins Mode */
+#define PORT_SET_PORT_PINS_MODE_SID (uint8)0x07
+
+/* Service ID for Port Get Drift Counters */
+#define PORT_GET_DRIFT_COUNTERS_SID (uint8)0x08
+
+/* Service ID for Port Init Port */
+#define PORT_INIT_PORT_SID (uint8)0x09
+
+/* Service ID for Port Switch Configuration */
+#define PORT_SWITCH_CONFIGURATION_SID (uint8)0x0A
+
+/* Service ID for Port Get Instrumentation */
+#define PORT_GET_INSTRUMENTATION_SID (uint8)0x0B
+
+/* Service ID for Port Init Image */
+#define PORT_INIT_IMAGE_SID (uint8)0x0C
+
+/* Service ID for Port Begin Update */
+#define PORT_BEGIN_UPDATE_SID (uint8)0x0D
+
+/* Service ID for Port Commit Update */
+#define PORT_COMMIT_UPDATE_SID (uint8)0x0E
+
+/* Service ID for Port Resync Shadow Registers */
+#define PORT_RESYNC_SHADOW_REGISTERS_SID (uint8)0x0F
+
+/* Service ID for Port Verify Configuration */
+#define PORT_VERIFY_CONFIGURATION_SID (uint8)0x10
+
+/* Service ID for Port Snapshot */
+#define PORT_SNAPSHOT_SID (uint8)0x11
+
+/* Service ID for Port Diff Snapshots */
+#define PORT_DIFF_SNAPSHOTS_SID (uint8)0x12
+
 /*******************************************************************************
  *                      DET Error Codes                                        *
  *******************************************************************************/
@@ -106,6 +148,9 @@
 
 /* DET code to report APIs called with a Null Pointer */
 #define PORT_E_PARAM_POINTER (uint8)0x10
+
+/* DET code to report API Port_BeginUpdate called during an update or Port_CommitUpdate called outside one */
+#define PORT_E_UPDATE_SEQUENCE (uint8)0x11
 /*******************************************************************************
  *                              Module Data Types                              *
  *******************************************************************************/
@@ -138,32 +183,313 @@ typedef enum
 /* Description: typedefinition to hold the pin mode*/
 typedef uint8 Port_PinModeType;
 
+/* Pin mode checked at compile time against the allowed modes of the pin (PORT_<Pin>_MODES),
+ * a mode the pin does not support makes the array size negative and fails the build.
+ * PORT_PIN_CONFIG and PORT_PORT_DEFAULT apply it with the modes of their own pin or port */
+#define PORT_CHECKED_MODE(PIN_MODES, MODE) \
+  ((Port_PinModeType)((MODE) + (0U * sizeof(char[(((MODE) < PORT_NUMBER_OF_PIN_MODES) && (((PIN_MODES) & PORT_MODE_BIT(MODE)) != 0)) ? 1 : -1]))))
+
 /* Description: Type of the external data structure containing the initialization data for this module.
- *	1. The PORT Which the pin belongs to. eg. PortA, PortB etc..
- *	2. The number of the pin in the PORT. eg. Pin1, Pin2 etc..
- *  3. The direction of the pin. (Input or Output)
- *  4. The pin mode. eg. DIO, ADC, CAN, LIN etc..
- *  5. The internal resistor. Disabled, Pull up or Pull down
- *  6. The initial value of the pin. (High or Low)
- *  7. Pin direction changeable during runtime (STD_ON/STD_OFF)
- *  8. Pin mode changeable during runtime (STD_ON/STD_OFF)
+ *	Configuration of one pin packed in 16 bits, built with PORT_PIN_CONFIG and read with the PORT_CONFIG_* accessors:
+ *	1. Bits 0-2:   The PORT Which the pin belongs to. eg. PortA, PortB etc..
+ *	2. Bits 3-5:   The number of the pin in the PORT. eg. Pin1, Pin2 etc..
+ *  3. Bit 6:      The direction of the pin. (Input or Output)
+ *  4. Bits 7-8:   The internal resistor. Disabled, Pull up or Pull down
+ *  5. Bit 9:      The initial value of the pin. (High or Low)
+ *  6. Bits 10-13: The pin mode. eg. DIO, ADC, CAN, LIN etc..
+ *  7. Bit 14:     Pin direction changeable during runtime (STD_ON/STD_OFF)
+ *  8. Bit 15:     Pin mode changeable during runtime (STD_ON/STD_OFF)
+ */
+typedef uint16 Port_ConfigSinglePinType;
+
+/* Positions and widths of the fields of Port_ConfigSinglePinType */
+#define PORT_CONFIG_PORT_SHIFT                (0U)
+#define PORT_CONFIG_PORT_MASK                 (0x7U)
+#define PORT_CONFIG_PIN_SHIFT                 (3U)
+#define PORT_CONFIG_PIN_MASK                  (0x7U)
+#define PORT_CONFIG_DIRECTION_SHIFT           (6U)
+#define PORT_CONFIG_DIRECTION_MASK            (0x1U)
+#define PORT_CONFIG_RESISTOR_SHIFT            (7U)
+#define PORT_CONFIG_RESISTOR_MASK             (0x3U)
+#define PORT_CONFIG_INITIAL_VALUE_SHIFT       (9U)
+#define PORT_CONFIG_INITIAL_VALUE_MASK        (0x1U)
+#define PORT_CONFIG_MODE_SHIFT                (10U)
+#define PORT_CONFIG_MODE_MASK                 (0xFU)
+#define PORT_CONFIG_DIRECTION_CHANGEABLE_SHIFT (14U)
+#define PORT_CONFIG_MODE_CHANGEABLE_SHIFT     (15U)
+
+/* Packs the configuration of one pin from its port and pin numbers, the mode is not checked */
+#define PORT_PACK_PIN_CONFIG(PORT, PIN, DIRECTION, RESISTOR, INITIAL_VALUE, MODE, DIRECTION_CHANGEABLE, MODE_CHANGEABLE) \
+  ((Port_ConfigSinglePinType)((((uint32)(PORT) & PORT_CONFIG_PORT_MASK) << PORT_CONFIG_PORT_SHIFT) | \
+                              (((uint32)(PIN) & PORT_CONFIG_PIN_MASK) << PORT_CONFIG_PIN_SHIFT) | \
+                              (((uint32)(DIRECTION) & PORT_CONFIG_DIRECTION_MASK) << PORT_CONFIG_DIRECTION_SHIFT) | \
+                              (((uint32)(RESISTOR) & PORT_CONFIG_RESISTOR_MASK) << PORT_CONFIG_RESISTOR_SHIFT) | \
+                              (((uint32)(INITIAL_VALUE) & PORT_CONFIG_INITIAL_VALUE_MASK) << PORT_CONFIG_INITIAL_VALUE_SHIFT) | \
+                              (((uint32)(MODE) & PORT_CONFIG_MODE_MASK) << PORT_CONFIG_MODE_SHIFT) | \
+                              (((uint32)(DIRECTION_CHANGEABLE) & 1U) << PORT_CONFIG_DIRECTION_CHANGEABLE_SHIFT) | \
+                              (((uint32)(MODE_CHANGEABLE) & 1U) << PORT_CONFIG_MODE_CHANGEABLE_SHIFT)))
+
+/* Packs the configuration of one pin, in the order of the fields of the original pin structure.
+ * The pin is given by its port letter and pin number (e.g. F, 1 for PF1), which also select the
+ * allowed modes PORT_P<port><pin>_MODES the mode is checked against at compile time */
+#define PORT_PIN_CONFIG(PORT_LETTER, PIN_NUMBER, DIRECTION, RESISTOR, INITIAL_VALUE, MODE, DIRECTION_CHANGEABLE, MODE_CHANGEABLE) \
+  PORT_PACK_PIN_CONFIG(PORT_Port##PORT_LETTER, PORT_Pin##PIN_NUMBER, (DIRECTION), (RESISTOR), (INITIAL_VALUE), \
+                       PORT_CHECKED_MODE(PORT_P##PORT_LETTER##PIN_NUMBER##_MODES, MODE), (DIRECTION_CHANGEABLE), (MODE_CHANGEABLE))
+
+/* Accessors of the fields of Port_ConfigSinglePinType */
+#define PORT_CONFIG_PORT(CONFIG)          ((uint8)(((CONFIG) >> PORT_CONFIG_PORT_SHIFT) & PORT_CONFIG_PORT_MASK))
+#define PORT_CONFIG_PIN(CONFIG)           ((uint8)(((CONFIG) >> PORT_CONFIG_PIN_SHIFT) & PORT_CONFIG_PIN_MASK))
+#define PORT_CONFIG_DIRECTION(CONFIG)     ((Port_PinDirectionType)(((CONFIG) >> PORT_CONFIG_DIRECTION_SHIFT) & PORT_CONFIG_DIRECTION_MASK))
+#define PORT_CONFIG_RESISTOR(CONFIG)      ((Port_InternalResistor)(((CONFIG) >> PORT_CONFIG_RESISTOR_SHIFT) & PORT_CONFIG_RESISTOR_MASK))
+#define PORT_CONFIG_INITIAL_VALUE(CONFIG) ((Port_PinLevelValue)(((CONFIG) >> PORT_CONFIG_INITIAL_VALUE_SHIFT) & PORT_CONFIG_INITIAL_VALUE_MASK))
+#define PORT_CONFIG_MODE(CONFIG)          ((Port_PinModeType)(((CONFIG) >> PORT_CONFIG_MODE_SHIFT) & PORT_CONFIG_MODE_MASK))
+#define PORT_CONFIG_IS_DIRECTION_CHANGEABLE(CONFIG) ((uint8)(((CONFIG) >> PORT_CONFIG_DIRECTION_CHANGEABLE_SHIFT) & 1U))
+#define PORT_CONFIG_IS_MODE_CHANGEABLE(CONFIG)      ((uint8)(((CONFIG) >> PORT_CONFIG_MODE_CHANGEABLE_SHIFT) & 1U))
+
+/* Packs the default configuration of the pins of a port given by its letter, the mode is checked at
+ * compile time against the modes allowed on every pin of the port (PORT_PORT<port>_MODES).
+ * The port and pin fields are not used */
+#define PORT_PORT_DEFAULT(PORT_LETTER, DIRECTION, RESISTOR, INITIAL_VALUE, MODE, DIRECTION_CHANGEABLE, MODE_CHANGEABLE) \
+  PORT_PACK_PIN_CONFIG(0U, 0U, (DIRECTION), (RESISTOR), (INITIAL_VALUE), PORT_CHECKED_MODE(PORT_PORT##PORT_LETTER##_MODES, MODE), \
+                       (DIRECTION_CHANGEABLE), (MODE_CHANGEABLE))
+
+/* Description: Type of the external data structure containing the initialization data for this module.
+ *	1. The configuration of the pins in use only, each keyed by the port and pin fields of its
+ *	   packed configuration, at most one entry per Pin ID.
+ *	2. The number of pins in use.
+ *	3. The configuration of the pins of each port that are not in use, indexed by the port number.
+ *	   Its mode must be allowed on every pin of the port (PORT_PORT<x>_MODES).
+ *	4. The ports initialized first by Port_Init, one bit per port number. With the Init Port API
+ *	   the other ports are left to Port_InitPort.
+ */
+typedef struct
+{
+  const Port_ConfigSinglePinType *pinConfig;
+  uint8 numberOfPins;
+  Port_ConfigSinglePinType portDefault[PORT_NUMBER_OF_PORTS];
+  uint8 earlyPorts;
+} Port_ConfigType;
+
+/* Magic number at the start of a post-build configuration image, "PCFG" in memory order */
+#define PORT_IMAGE_MAGIC (0x47464350U)
+
+/* Offset of the first byte covered by the CRC of a post-build configuration image, right after the CRC field */
+#define PORT_IMAGE_CRC_OFFSET (8U)
+
+/* Description: Header of a post-build configuration image, 20 bytes. The header is followed by
+ * the packed default configuration of every port and then the packed configuration of every
+ * pin in use, as in Port_ConfigType.
+ *	1. PORT_IMAGE_MAGIC.
+ *	2. CRC-32 of the image from the length field to the end of the pin table.
+ *	3. Number of bytes after the header.
+ *	4. AUTOSAR and software versions the image was built for, those of Port_PBcfg.c.
+ *	5. Number of pins in use.
+ *	6. The ports initialized first by Port_Init, one bit per port number.
+ */
+typedef struct
+{
+  uint32 magic;
+  uint32 crc;
+  uint16 length;
+  uint8 arMajorVersion;
+  uint8 arMinorVersion;
+  uint8 arPatchVersion;
+  uint8 swMajorVersion;
+  uint8 swMinorVersion;
+  uint8 swPatchVersion;
+  uint8 numberOfPins;
+  uint8 earlyPorts;
+  uint8 reserved[2];
+} Port_ImageHeaderType;
+
+/* Largest post-build configuration image, with every pin of the MCU in use */
+#define PORT_IMAGE_MAX_SIZE (sizeof(Port_ImageHeaderType) + ((PORT_NUMBER_OF_PORTS + PORT_NUMBER_OF_PINS) * sizeof(Port_ConfigSinglePinType)))
+
+/* Description: Register images of one port folded from the configuration of its pins.
+ *	Each value is written to the port register under its mask only, so pins that are
+ *	not configured (e.g. JTAG pins PC0-PC3) keep their current register bits.
  */
 typedef struct
 {
-  uint8 portNumber;
-  Port_PinType pinNumber;
-  Port_PinDirectionType direction;
-  Port_InternalResistor internalResistor;
-  Port_PinLevelValue initialValue;
-  Port_PinModeType mode;
-  uint8 isDirectionChangeable;
-  uint8 isModeChangeable;
-} Port_ConfigSinglePinType;
+  uint32 pctl;
+  uint32 pctlMask;
+  uint8 ownedMask;
+  uint8 commitMask;
+  uint8 dir;
+  uint8 data;
+  uint8 dataMask;
+  uint8 pur;
+  uint8 pdr;
+  uint8 pullMask;
+  uint8 den;
+  uint8 amsel;
+  uint8 afsel;
+  uint8 dirChangeableMask;
+  uint8 modeChangeableMask;
+} Port_PortImageType;
+
+/* Registers compared by Port_VerifyConfiguration, numbered in their order in the mismatch bitmap of a port */
+#define PORT_VERIFY_DIR (0U)
+#define PORT_VERIFY_AFSEL (1U)
+#define PORT_VERIFY_PUR (2U)
+#define PORT_VERIFY_PDR (3U)
+#define PORT_VERIFY_DEN (4U)
+#define PORT_VERIFY_AMSEL (5U)
+#define PORT_VERIFY_PCTL (6U)
+#define PORT_VERIFY_REGISTERS_PER_PORT (7U)
+
+/* Bit of a register of a port in the mismatch bitmap returned by Port_VerifyConfiguration */
+#define PORT_VERIFY_MISMATCH_BIT(PORT, REG) ((uint64)1U << (((PORT) * PORT_VERIFY_REGISTERS_PER_PORT) + (REG)))
+
+/* Mismatch bitmap with every register of every port set, returned when the driver is not initialized */
+#define PORT_VERIFY_ALL_REGISTERS (PORT_VERIFY_MISMATCH_BIT(PORT_NUMBER_OF_PORTS, 0U) - 1U)
+
+/* Description: Expected values of the configuration registers of one port checked by Port_VerifyConfiguration.
+ *	1. DIR, AFSEL, PUR, PDR, DEN and AMSEL packed one per byte in the order of their PORT_VERIFY numbers.
+ *	2. The bits of the packed registers fixed by the configuration, the pins not configured and the
+ *	   direction or mode of the changeable pins are not checked.
+ *	3. The expected PCTL value and its bits fixed by the configuration.
+ */
+typedef struct
+{
+  uint64 expected;
+  uint64 mask;
+  uint32 pctl;
+  uint32 pctlMask;
+} Port_VerifyImageType;
+
+/* Description: Constant hardware descriptor of one pin, in a table indexed by the Pin ID.
+ *	1. The GPIO Registers base address of the pin port.
+ *	2. The bit of the pin in the 8-bit port registers.
+ *	3. The position of the pin PMCx bits in the port control register.
+ *	4. The port number of the pin.
+ */
+typedef struct
+{
+  uint32 base;
+  uint8 bitMask;
+  uint8 pctlShift;
+  uint8 port;
+} Port_PinDescriptorType;
+
+/* Description: Register write counts of Port_Init.
+ *	1. Writes a per-pin initialization of the configuration would need.
+ *	2. Writes done by Port_Init with one masked write per register per port.
+ */
+typedef struct
+{
+  uint16 perPinWrites;
+  uint16 coalescedWrites;
+} Port_InitStatisticsType;
 
+/* Description: Bits of the registers of one port that differ between two configuration sets.
+ *	Only the bits set in a mask are written, with their value taken from the new set.
+ */
 typedef struct
 {
-  Port_ConfigSinglePinType pinConfig[PORT_NUMBER_OF_PINS];
-} Port_ConfigType;
+  uint32 pctl;
+  uint32 pctlMask;
+  uint8 commitMask;
+  uint8 amsel;
+  uint8 amselMask;
+  uint8 afsel;
+  uint8 afselMask;
+  uint8 pur;
+  uint8 purMask;
+  uint8 pdr;
+  uint8 pdrMask;
+  uint8 den;
+  uint8 denMask;
+  uint8 data;
+  uint8 dataMask;
+  uint8 dir;
+  uint8 dirMask;
+} Port_PortDeltaType;
+
+/* Description: GPIO registers of one port captured by Port_Snapshot, the 8-bit registers are
+ *	stored one byte each so the structure has no padding.
+ */
+typedef struct
+{
+  uint32 pctl;
+  uint8 data;
+  uint8 dir;
+  uint8 afsel;
+  uint8 pur;
+  uint8 pdr;
+  uint8 den;
+  uint8 cr;
+  uint8 amsel;
+} Port_PortSnapshotType;
+
+/* Description: GPIO registers of all the ports captured by Port_Snapshot.
+ *	1. The registers of each port, indexed by the port number. Ports not captured read as 0.
+ *	2. The ports that were clocked and captured, one bit per port number.
+ */
+typedef struct
+{
+  Port_PortSnapshotType ports[PORT_NUMBER_OF_PORTS];
+  uint8 portMask;
+  uint8 reserved[3];
+} Port_SnapshotType;
+
+/* Description: Precomputed switch from one configuration set to another, filled on first use by Port_SwitchConfiguration.
+ *	1. The configuration set the delta starts from.
+ *	2. The configuration set the delta leads to.
+ *	3. The Port_Init the delta was computed after, it is computed again after the next one.
+ *	4. The register images of the new configuration set.
+ *	5. The register bits to be written on each port.
+ */
+typedef struct
+{
+  const Port_ConfigType *fromConfig;
+  const Port_ConfigType *toConfig;
+  uint32 generation;
+  Port_PortImageType toImages[PORT_NUMBER_OF_PORTS];
+  Port_PortDeltaType ports[PORT_NUMBER_OF_PORTS];
+} Port_ConfigDeltaType;
+
+/* Saturation value of the direction drift counters */
+#define PORT_DRIFT_COUNTER_MAX (0xFFFFU)
+
+/* Description: Direction corrections done by Port_RefreshPortDirection.
+ *	1. Number of refreshes that found the direction register of each port drifted.
+ *	2. Number of refreshes that found each pin drifted, indexed by the Pin ID.
+ */
+typedef struct
+{
+  uint16 portCorrections[PORT_NUMBER_OF_PORTS];
+  uint16 pinCorrections[PORT_NUMBER_OF_PINS];
+} Port_DriftCountersType;
+
+/* Number of log2 buckets of the cycle histograms, one per bit of the cycle count */
+#define PORT_CYCLE_HISTOGRAM_BUCKETS (32U)
+
+/* Number of service IDs with call statistics, the instrumented APIs have the service IDs 0x00 to 0x04 */
+#define PORT_INSTRUMENTED_SIDS (PORT_SET_PIN_MODE_SID + 1U)
+
+/* Description: Call statistics of one API.
+ *	1. Number of calls.
+ *	2. Minimum, maximum and average cycles of one call.
+ *	3. Total cycles of all the calls.
+ *	4. Number of calls per log2 of their cycles, bucket k counts calls of 2^k to 2^(k+1)-1 cycles
+ *	   and bucket 0 also counts calls of 0 cycles.
+ */
+typedef struct
+{
+  uint32 calls;
+  uint32 minCycles;
+  uint32 maxCycles;
+  uint32 avgCycles;
+  uint64 totalCycles;
+  uint32 histogram[PORT_CYCLE_HISTOGRAM_BUCKETS];
+} Port_ApiStatisticsType;
+
+/* Description: Call statistics of the instrumented APIs, indexed by their service ID. */
+typedef struct
+{
+  Port_ApiStatisticsType api[PORT_INSTRUMENTED_SIDS];
+} Port_InstrumentationType;
 
 /* MCU Pin IDs */
 #define PA0 (Port_PinType)0U
@@ -234,10 +560,80 @@ void Port_GetVersionInfo(Std_VersionInfoType *versioninfo);
 #endif
 
 /* Sets the port pin mode */
-#if (PORT_SET_PIN_MODE == STD_ON)
+#if (PORT_SET_PIN_MODE_API == STD_ON)
 void Port_SetPinMode(Port_PinType Pin, Port_PinModeType Mode);
 #endif
 
+/* Returns the register write counts of the last Port_Init call */
+#if (PORT_INIT_STATISTICS_API == STD_ON)
+void Port_GetInitStatistics(Port_InitStatisticsType *Statistics);
+#endif
+
+/* Sets the direction of a group of pins of one port */
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+void Port_SetPortPinsDirection(uint8 Port, uint8 PinMask, uint8 DirectionBits);
+#endif
+
+/* Sets the mode of a group of pins of one port */
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+void Port_SetPortPinsMode(uint8 Port, uint8 PinMask, Port_PinModeType Mode);
+#endif
+
+/* Returns the direction corrections done by Port_RefreshPortDirection */
+#if (PORT_REFRESH_DRIFT_DETECTION == STD_ON)
+void Port_GetDriftCounters(Port_DriftCountersType *Counters);
+#endif
+
+/* Initializes one port of the configuration set passed to Port_Init */
+#if (PORT_INIT_PORT_API == STD_ON)
+void Port_InitPort(uint8 Port);
+#endif
+
+/* Returns a snapshot of the call statistics of the instrumented APIs */
+#if (PORT_INSTRUMENTATION == STD_ON)
+void Port_GetInstrumentation(Port_InstrumentationType *Snapshot);
+#endif
+
+/* Initializes the Port Driver module from a post-build configuration image used in place */
+#if (PORT_INIT_IMAGE_API == STD_ON)
+Std_ReturnType Port_InitImage(const Port_ImageHeaderType *ImagePtr);
+#endif
+
+/* Starts staging direction and mode changes in RAM shadows of the port registers */
+#if (PORT_UPDATE_TRANSACTION_API == STD_ON)
+void Port_BeginUpdate(void);
+#endif
+
+/* Writes the direction and mode changes staged since Port_BeginUpdate */
+#if (PORT_UPDATE_TRANSACTION_API == STD_ON)
+void Port_CommitUpdate(void);
+#endif
+
+/* Reloads the register shadows of the initialized ports from the hardware */
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+void Port_ResyncShadowRegisters(void);
+#endif
+
+/* Compares the configuration registers of the initialized ports with the configuration set */
+#if (PORT_VERIFY_CONFIGURATION_API == STD_ON)
+uint64 Port_VerifyConfiguration(void);
+#endif
+
+/* Captures the GPIO configuration and data registers of every clocked port in one pass */
+#if (PORT_SNAPSHOT_API == STD_ON)
+void Port_Snapshot(Port_SnapshotType *Snapshot);
+#endif
+
+/* Returns the bits that differ between two snapshots and the ports they are on */
+#if (PORT_SNAPSHOT_API == STD_ON)
+uint8 Port_DiffSnapshots(const Port_SnapshotType *Before, const Port_SnapshotType *After, Port_SnapshotType *Changes);
+#endif
+
+/* Switches from the active configuration set to another one writing only the differing register bits */
+#if (PORT_SWITCH_CONFIGURATION_API == STD_ON)
+void Port_SwitchConfiguration(const Port_ConfigType *ConfigPtr, Port_ConfigDeltaType *Delta);
+#endif
+
 /*******************************************************************************
  *                       External Variables                                    *
  *******************************************************************************/
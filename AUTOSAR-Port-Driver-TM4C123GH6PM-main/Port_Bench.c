@@ -0,0 +1,655 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Bench.c
+ *
+ * Description: Host benchmark of the Port Driver APIs. Every API is called on every Pin ID from PA0 to
+ *              PF4 under three configuration profiles (all GPIO, heavy alternate function and mixed ADC).
+ *              Each call is measured on the simulated register file and checked against its budget in
+ *              Port_Sim_Budget.h. The program exits with a non-zero status when any call exceeds it.
+ *              It also reports the bus cycles of the operations compared between the APB and the AHB
+ *              apertures, to be run once with each setting of PORT_AHB_APERTURE.
+ *
+ * Author: Ammar Moataz
+ ******************************************************************************/
+
+/* ioctl() and syscall() of the Linux branch counter */
+#define _DEFAULT_SOURCE
+
+#include "Port.h"
+#include "Port_Sim.h"
+#include "Dio.h"
+#include "Det.h"
+
+#if (PORT_HOST_BACKEND == STD_ON)
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/* Number of times each call is repeated, the shortest wall time and branch count are kept */
+#define PORT_BENCH_REPEATS              (16U)
+
+/* Number of configuration profiles */
+#define PORT_BENCH_NUMBER_OF_PROFILES   (3U)
+
+/* Rows of the report of each profile */
+#define PORT_BENCH_ROW_INIT             (0U)
+#define PORT_BENCH_ROW_SET_DIRECTION    (1U)
+#define PORT_BENCH_ROW_SET_MODE         (2U)
+#define PORT_BENCH_ROW_REFRESH          (3U)
+#define PORT_BENCH_ROW_VERIFY           (4U)
+#define PORT_BENCH_ROW_SNAPSHOT         (5U)
+#define PORT_BENCH_NUMBER_OF_ROWS       (6U)
+
+/* Number of times each aperture operation is done */
+#define PORT_BENCH_APERTURE_ROUNDS      (1000U)
+
+/* Branch count reported when the host has no usable branch counter */
+#define PORT_BENCH_NO_BRANCHES          (0xFFFFFFFFU)
+
+/* Description: One call of a Port API measured by the benchmark.
+ *	1. The row of the report the call is counted in, and its service ID.
+ *	2. The Pin ID and the direction or mode passed to pin APIs.
+ */
+typedef struct
+{
+  uint8 row;
+  uint8 apiId;
+  Port_PinType pin;
+  uint8 argument;
+} Port_Bench_CallType;
+
+/* Description: Worst case of the calls of one row of the report.
+ *	1. The number of calls, the calls rejected with a development error and the budget violations.
+ *	2. The highest register reads, writes and modeled bus cycles of one call.
+ *	3. The highest wall time and branch count of one call, each the shortest of its repeats.
+ */
+typedef struct
+{
+  uint32 calls;
+  uint32 rejected;
+  uint32 violations;
+  uint32 reads;
+  uint32 writes;
+  uint32 busCycles;
+  uint64 elapsedNs;
+  uint32 branches;
+} Port_Bench_RowType;
+
+/* Description: Configuration profile benchmarked.
+ *	1. The name printed in the report.
+ *	2. The configuration set.
+ */
+typedef struct
+{
+  const char *name;
+  const Port_ConfigType *config;
+} Port_Bench_ProfileType;
+
+/* Every pin is a changeable GPIO input, taken from the port defaults */
+STATIC const Port_ConfigType Port_Bench_AllGpio = {
+    NULL_PTR,
+    0U,
+    {
+        PORT_PORT_DEFAULT(A, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(B, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(C, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(D, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(E, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(F, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON)},
+    0U};
+
+/* UART, SSI, I2C, CAN, timer and PWM functions on every pin that has one, including the locked PD7 and PF0 */
+STATIC const Port_ConfigSinglePinType Port_Bench_HeavyAfPins[] = {
+    PORT_PIN_CONFIG(A, 0, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PA0_U0Rx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(A, 1, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, PA1_U0Tx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(A, 2, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, PA2_SSI0Clk, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(A, 3, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, PA3_SSI0Fss, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(A, 4, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PA4_SSI0Rx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(A, 5, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, PA5_SSI0Tx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(A, 6, PORT_PIN_OUT, PULL_UP, PORT_PIN_LEVEL_HIGH, PA6_I2C1SCL, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(A, 7, PORT_PIN_OUT, PULL_UP, PORT_PIN_LEVEL_HIGH, PA7_I2C1SDA, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(B, 0, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PB0_U1Rx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(B, 1, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, PB1_U1Tx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(B, 2, PORT_PIN_OUT, PULL_UP, PORT_PIN_LEVEL_HIGH, PB2_I2C0SCL, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(B, 3, PORT_PIN_OUT, PULL_UP, PORT_PIN_LEVEL_HIGH, PB3_I2C0SDA, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(B, 4, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, PB4_SSI2Clk, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(B, 5, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, PB5_SSI2Fss, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(B, 6, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PB6_SSI2Rx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(B, 7, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, PB7_SSI2Tx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(C, 4, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PC4_U4Rx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(C, 5, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, PC5_U4Tx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(C, 6, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PC6_U3Rx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(C, 7, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PC7_WT1CCP1, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(D, 0, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, PD0_SSI3Clk, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(D, 1, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, PD1_SSI3Fss, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(D, 2, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PD2_SSI3Rx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(D, 3, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, PD3_SSI3Tx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(D, 4, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PD4_U6Rx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(D, 5, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, PD5_U6Tx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(D, 6, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PD6_U2Rx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(D, 7, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, PD7_U2Tx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(E, 0, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PE0_U7Rx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(E, 1, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, PE1_U7Tx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(E, 4, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PE4_CAN0Rx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(E, 5, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, PE5_CAN0Tx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(F, 0, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, PF0_M1PWM4, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(F, 1, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, PF1_M1PWM5, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(F, 2, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, PF2_M1PWM6, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(F, 3, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, PF3_M1PWM7, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(F, 4, PORT_PIN_IN, PULL_UP, PORT_PIN_LEVEL_HIGH, GPIO_MODE, STD_ON, STD_ON)};
+
+STATIC const Port_ConfigType Port_Bench_HeavyAf = {
+    Port_Bench_HeavyAfPins,
+    (uint8)(sizeof(Port_Bench_HeavyAfPins) / sizeof(Port_Bench_HeavyAfPins[0])),
+    {
+        PORT_PORT_DEFAULT(A, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(B, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(C, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(D, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(E, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(F, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON)},
+    0U};
+
+/* Analog inputs on PB4-PB5, PD0-PD3 and PE0-PE5, LEDs and a button on port F and UART0 */
+STATIC const Port_ConfigSinglePinType Port_Bench_MixedAdcPins[] = {
+    PORT_PIN_CONFIG(A, 0, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, PA0_U0Rx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(A, 1, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, PA1_U0Tx, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(B, 4, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, ADC_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(B, 5, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, ADC_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(D, 0, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, ADC_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(D, 1, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, ADC_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(D, 2, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, ADC_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(D, 3, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, ADC_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(E, 0, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, ADC_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(E, 1, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, ADC_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(E, 2, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, ADC_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(E, 3, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, ADC_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(E, 4, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, ADC_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(E, 5, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, ADC_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(F, 1, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(F, 2, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(F, 3, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(F, 4, PORT_PIN_IN, PULL_UP, PORT_PIN_LEVEL_HIGH, GPIO_MODE, STD_OFF, STD_OFF)};
+
+STATIC const Port_ConfigType Port_Bench_MixedAdc = {
+    Port_Bench_MixedAdcPins,
+    (uint8)(sizeof(Port_Bench_MixedAdcPins) / sizeof(Port_Bench_MixedAdcPins[0])),
+    {
+        PORT_PORT_DEFAULT(A, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(B, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(C, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(D, PORT_PIN_IN, PULL_DOWN, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_OFF, STD_OFF),
+        PORT_PORT_DEFAULT(E, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(F, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON)},
+    (1U << PORT_PortF)};
+
+STATIC const Port_Bench_ProfileType Port_Bench_Profiles[PORT_BENCH_NUMBER_OF_PROFILES] = {
+    {"all-GPIO", &Port_Bench_AllGpio},
+    {"heavy-AF", &Port_Bench_HeavyAf},
+    {"mixed-ADC", &Port_Bench_MixedAdc}};
+
+STATIC const char *const Port_Bench_RowNames[PORT_BENCH_NUMBER_OF_ROWS] = {
+    "Port_Init",
+    "Port_SetPinDirection",
+    "Port_SetPinMode",
+    "Port_RefreshPortDirection",
+    "Port_VerifyConfiguration",
+    "Port_Snapshot"};
+
+
+/* Profile being benchmarked */
+STATIC const Port_ConfigType *Port_Bench_Config;
+
+/* User space branch counter, -1 when the host does not provide one */
+STATIC int Port_Bench_BranchCounter = -1;
+
+/* Branches counted around an empty call, subtracted from every count */
+STATIC uint32 Port_Bench_BranchOverhead = 0;
+
+/************************************************************************************
+ * Function Name: Port_Bench_OpenBranchCounter
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Opens a counter of the branch instructions retired in user space by this process.
+ *              Hosts without performance counters, e.g. most containers, report no branch counts.
+ ************************************************************************************/
+STATIC void Port_Bench_OpenBranchCounter(void)
+{
+#if defined(__linux__)
+    struct perf_event_attr attributes;
+
+    memset(&attributes, 0, sizeof(attributes));
+    attributes.type = PERF_TYPE_HARDWARE;
+    attributes.size = sizeof(attributes);
+    attributes.config = PERF_COUNT_HW_BRANCH_INSTRUCTIONS;
+    attributes.disabled = 1;
+    attributes.exclude_kernel = 1;
+    attributes.exclude_hv = 1;
+    Port_Bench_BranchCounter = (int)syscall(__NR_perf_event_open, &attributes, 0, -1, -1, 0);
+#endif
+}
+
+/************************************************************************************
+ * Function Name: Port_Bench_StartBranches / Port_Bench_StopBranches
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Branches counted since Port_Bench_StartBranches, PORT_BENCH_NO_BRANCHES without a counter
+ * Description: Counts the branches of the code run between the two calls.
+ ************************************************************************************/
+STATIC void Port_Bench_StartBranches(void)
+{
+#if defined(__linux__)
+    if (Port_Bench_BranchCounter >= 0)
+    {
+        (void)ioctl(Port_Bench_BranchCounter, PERF_EVENT_IOC_RESET, 0);
+        (void)ioctl(Port_Bench_BranchCounter, PERF_EVENT_IOC_ENABLE, 0);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+}
+
+STATIC uint32 Port_Bench_StopBranches(void)
+{
+#if defined(__linux__)
+    uint64 count;
+
+    if (Port_Bench_BranchCounter >= 0)
+    {
+        (void)ioctl(Port_Bench_BranchCounter, PERF_EVENT_IOC_DISABLE, 0);
+        if (read(Port_Bench_BranchCounter, &count, sizeof(count)) == (ssize_t)sizeof(count))
+        {
+            return (uint32)count;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+    return PORT_BENCH_NO_BRANCHES;
+}
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+/* Pin ID of the first pin of each port, indexed by the port number */
+STATIC const Port_PinType Port_Bench_FirstPinId[PORT_NUMBER_OF_PORTS] = {PA0, PB0, PC0, PD0, PE0, PF0};
+
+/************************************************************************************
+ * Function Name: Port_Bench_ConfiguredMode
+ * Parameters (in): Pin - Pin ID
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Mode of the pin in the profile being benchmarked
+ * Description: Looks the pin up in the pins in use of the profile, or takes the default of its port.
+ ************************************************************************************/
+STATIC Port_PinModeType Port_Bench_ConfiguredMode(Port_PinType Pin)
+{
+    uint8 port = PORT_PortF;
+    uint8 index;
+
+    while (Pin < Port_Bench_FirstPinId[port])
+    {
+        port--;
+    }
+
+    for (index = 0; index < Port_Bench_Config->numberOfPins; index++)
+    {
+        Port_ConfigSinglePinType pinConfig = Port_Bench_Config->pinConfig[index];
+
+        if ((PORT_CONFIG_PORT(pinConfig) == port) && (PORT_CONFIG_PIN(pinConfig) == (uint8)(Pin - Port_Bench_FirstPinId[port])))
+        {
+            return PORT_CONFIG_MODE(pinConfig);
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return PORT_CONFIG_MODE(Port_Bench_Config->portDefault[port]);
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_Bench_Call
+ * Parameters (in): Call - API call to be made
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Makes one measured API call.
+ ************************************************************************************/
+STATIC void Port_Bench_Call(const Port_Bench_CallType *Call)
+{
+#if (PORT_SNAPSHOT_API == STD_ON)
+    Port_SnapshotType snapshot;
+#endif
+
+    switch (Call->row)
+    {
+    case PORT_BENCH_ROW_INIT:
+        Port_Init(Port_Bench_Config);
+        break;
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+    case PORT_BENCH_ROW_SET_DIRECTION:
+        Port_SetPinDirection(Call->pin, (Port_PinDirectionType)Call->argument);
+        break;
+#endif
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+    case PORT_BENCH_ROW_SET_MODE:
+        Port_SetPinMode(Call->pin, Call->argument);
+        break;
+#endif
+    case PORT_BENCH_ROW_REFRESH:
+        Port_RefreshPortDirection();
+        break;
+#if (PORT_VERIFY_CONFIGURATION_API == STD_ON)
+    case PORT_BENCH_ROW_VERIFY:
+        (void)Port_VerifyConfiguration();
+        break;
+#endif
+#if (PORT_SNAPSHOT_API == STD_ON)
+    case PORT_BENCH_ROW_SNAPSHOT:
+        Port_Snapshot(&snapshot);
+        break;
+#endif
+    default:
+        break;
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_Bench_Measure
+ * Parameters (in): Call - API call to be measured
+ * Parameters (inout): Row - Worst case of the row of the call
+ * Parameters (out): None
+ * Return value: E_OK if the call stayed within its budget
+ * Description: Repeats a call PORT_BENCH_REPEATS times from the same register state, keeps its
+ *              highest register accesses and its shortest wall time and branch count, and checks
+ *              the result against the budget of the API.
+ ************************************************************************************/
+STATIC Std_ReturnType Port_Bench_Measure(const Port_Bench_CallType *Call, Port_Bench_RowType *Row)
+{
+    Port_Sim_MeasurementType worst;
+    Port_Sim_MeasurementType measurement;
+    Det_ErrorType error;
+    uint32 branches = PORT_BENCH_NO_BRANCHES;
+    uint32 count;
+    uint8 repeat;
+    Std_ReturnType result;
+
+    memset(&worst, 0, sizeof(worst));
+    worst.elapsedNs = (uint64)-1;
+
+    for (repeat = 0; repeat < PORT_BENCH_REPEATS; repeat++)
+    {
+        /* Port_Init is measured from the reset state every time */
+        if (Call->row == PORT_BENCH_ROW_INIT)
+        {
+            Port_Sim_Reset();
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        Port_Sim_StartMeasurement();
+        Port_Bench_StartBranches();
+        Port_Bench_Call(Call);
+        count = Port_Bench_StopBranches();
+        Port_Sim_StopMeasurement(&measurement);
+
+        worst.reads = (measurement.reads > worst.reads) ? measurement.reads : worst.reads;
+        worst.writes = (measurement.writes > worst.writes) ? measurement.writes : worst.writes;
+        worst.faults = (measurement.faults > worst.faults) ? measurement.faults : worst.faults;
+        worst.busCycles = (measurement.busCycles > worst.busCycles) ? measurement.busCycles : worst.busCycles;
+        worst.elapsedNs = (measurement.elapsedNs < worst.elapsedNs) ? measurement.elapsedNs : worst.elapsedNs;
+        if (count != PORT_BENCH_NO_BRANCHES)
+        {
+            count = (count > Port_Bench_BranchOverhead) ? (count - Port_Bench_BranchOverhead) : 0U;
+            branches = (count < branches) ? count : branches;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    /* Calls rejected with a development error, e.g. on a pin that is not changeable, are still measured */
+    Row->calls++;
+    if (Det_GetError(&error) == E_OK)
+    {
+        Row->rejected++;
+        while (Det_GetError(&error) == E_OK)
+        {
+        }
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    result = Port_Sim_CheckBudget(Call->apiId, &worst);
+    if (result != E_OK)
+    {
+        Row->violations++;
+        printf("BUDGET EXCEEDED: %s pin %u: %u reads, %u writes, %u faults, %llu ns\n", Port_Bench_RowNames[Call->row],
+               (unsigned)Call->pin, (unsigned)worst.reads, (unsigned)worst.writes, (unsigned)worst.faults,
+               (unsigned long long)worst.elapsedNs);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    Row->reads = (worst.reads > Row->reads) ? worst.reads : Row->reads;
+    Row->writes = (worst.writes > Row->writes) ? worst.writes : Row->writes;
+    Row->busCycles = (worst.busCycles > Row->busCycles) ? worst.busCycles : Row->busCycles;
+    Row->elapsedNs = (worst.elapsedNs > Row->elapsedNs) ? worst.elapsedNs : Row->elapsedNs;
+    if (branches != PORT_BENCH_NO_BRANCHES)
+    {
+        Row->branches = ((Row->branches == PORT_BENCH_NO_BRANCHES) || (branches > Row->branches)) ? branches : Row->branches;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    return result;
+}
+
+/************************************************************************************
+ * Function Name: Port_Bench_RunProfile
+ * Parameters (in): Profile - Configuration profile
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Number of calls that exceeded their budget
+ * Description: Initializes the driver with the profile, then sets every pin from PA0 to PF4 to output
+ *              and back to input, to GPIO and back to its configured mode, and runs the port wide APIs.
+ ************************************************************************************/
+STATIC uint32 Port_Bench_RunProfile(const Port_Bench_ProfileType *Profile)
+{
+    Port_Bench_RowType rows[PORT_BENCH_NUMBER_OF_ROWS];
+    Port_Bench_CallType call;
+    uint32 violations = 0;
+    uint8 row;
+
+    memset(rows, 0, sizeof(rows));
+    for (row = 0; row < PORT_BENCH_NUMBER_OF_ROWS; row++)
+    {
+        rows[row].branches = PORT_BENCH_NO_BRANCHES;
+    }
+    Port_Bench_Config = Profile->config;
+
+    call.pin = 0;
+    call.argument = 0;
+    call.row = PORT_BENCH_ROW_INIT;
+    call.apiId = PORT_INIT_SID;
+    (void)Port_Bench_Measure(&call, &rows[PORT_BENCH_ROW_INIT]);
+
+    for (call.pin = PA0; call.pin < PORT_NUMBER_OF_PINS; call.pin++)
+    {
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+        call.row = PORT_BENCH_ROW_SET_DIRECTION;
+        call.apiId = PORT_SET_PIN_DIRECTION_SID;
+        call.argument = PORT_PIN_OUT;
+        (void)Port_Bench_Measure(&call, &rows[PORT_BENCH_ROW_SET_DIRECTION]);
+        call.argument = PORT_PIN_IN;
+        (void)Port_Bench_Measure(&call, &rows[PORT_BENCH_ROW_SET_DIRECTION]);
+#endif
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+        call.row = PORT_BENCH_ROW_SET_MODE;
+        call.apiId = PORT_SET_PIN_MODE_SID;
+        call.argument = GPIO_MODE;
+        (void)Port_Bench_Measure(&call, &rows[PORT_BENCH_ROW_SET_MODE]);
+        call.argument = Port_Bench_ConfiguredMode(call.pin);
+        (void)Port_Bench_Measure(&call, &rows[PORT_BENCH_ROW_SET_MODE]);
+#endif
+    }
+
+    call.pin = 0;
+    call.argument = 0;
+    call.row = PORT_BENCH_ROW_REFRESH;
+    call.apiId = PORT_REFRESH_PORT_DIRECTION_SID;
+    (void)Port_Bench_Measure(&call, &rows[PORT_BENCH_ROW_REFRESH]);
+#if (PORT_VERIFY_CONFIGURATION_API == STD_ON)
+    call.row = PORT_BENCH_ROW_VERIFY;
+    call.apiId = PORT_VERIFY_CONFIGURATION_SID;
+    (void)Port_Bench_Measure(&call, &rows[PORT_BENCH_ROW_VERIFY]);
+#endif
+#if (PORT_SNAPSHOT_API == STD_ON)
+    call.row = PORT_BENCH_ROW_SNAPSHOT;
+    call.apiId = PORT_SNAPSHOT_SID;
+    (void)Port_Bench_Measure(&call, &rows[PORT_BENCH_ROW_SNAPSHOT]);
+#endif
+
+    printf("\nProfile %s\n", Profile->name);
+    printf("%-26s %6s %9s %6s %7s %11s %7s %9s %10s\n", "API", "calls", "rejected", "reads", "writes", "bus cycles", "ns", "branches", "violations");
+    for (row = 0; row < PORT_BENCH_NUMBER_OF_ROWS; row++)
+    {
+        if (rows[row].calls != 0)
+        {
+            printf("%-26s %6u %9u %6u %7u %11u %7llu ", Port_Bench_RowNames[row], (unsigned)rows[row].calls,
+                   (unsigned)rows[row].rejected, (unsigned)rows[row].reads, (unsigned)rows[row].writes,
+                   (unsigned)rows[row].busCycles, (unsigned long long)rows[row].elapsedNs);
+            if (rows[row].branches != PORT_BENCH_NO_BRANCHES)
+            {
+                printf("%9u", (unsigned)rows[row].branches);
+            }
+            else
+            {
+                printf("%9s", "n/a");
+            }
+            printf(" %10u\n", (unsigned)rows[row].violations);
+            violations += rows[row].violations;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return violations;
+}
+
+/************************************************************************************
+ * Function Name: Port_Bench_RunAperture
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Prints the bus cycles of Port_Init with the shipped configuration, of toggles of PF1
+ *              through its masked data address and of round trips of Port_SwitchConfiguration between
+ *              the shipped configuration and the heavy-AF profile, through the aperture built in.
+ ************************************************************************************/
+STATIC void Port_Bench_RunAperture(void)
+{
+    Port_Sim_MeasurementType measurement;
+#if (PORT_SWITCH_CONFIGURATION_API == STD_ON)
+    Port_ConfigDeltaType toHeavyAf;
+    Port_ConfigDeltaType toShipped;
+#endif
+    uint32 round;
+
+    printf("\nAperture %s, shipped configuration\n", (PORT_AHB_APERTURE == STD_ON) ? "AHB" : "APB");
+    printf("%-58s %11s\n", "Operation", "bus cycles");
+
+    Port_Sim_Reset();
+    Port_Sim_StartMeasurement();
+    Port_Init(&Port_PinConfigArray);
+    Port_Sim_StopMeasurement(&measurement);
+    printf("%-58s %11u\n", "Port_Init", (unsigned)measurement.busCycles);
+
+    Port_Sim_StartMeasurement();
+    for (round = 0; round < PORT_BENCH_APERTURE_ROUNDS; round++)
+    {
+        (void)Dio_FlipChannel(PF1);
+    }
+    Port_Sim_StopMeasurement(&measurement);
+    printf("%u %-53s %11u\n", (unsigned)PORT_BENCH_APERTURE_ROUNDS, "toggles of PF1 (Dio_FlipChannel)", (unsigned)measurement.busCycles);
+
+#if (PORT_SWITCH_CONFIGURATION_API == STD_ON)
+    /* The deltas are computed by the first round trip, which is not measured */
+    memset(&toHeavyAf, 0, sizeof(toHeavyAf));
+    memset(&toShipped, 0, sizeof(toShipped));
+    Port_SwitchConfiguration(&Port_Bench_HeavyAf, &toHeavyAf);
+    Port_SwitchConfiguration(&Port_PinConfigArray, &toShipped);
+
+    Port_Sim_StartMeasurement();
+    for (round = 0; round < PORT_BENCH_APERTURE_ROUNDS; round++)
+    {
+        Port_SwitchConfiguration(&Port_Bench_HeavyAf, &toHeavyAf);
+        Port_SwitchConfiguration(&Port_PinConfigArray, &toShipped);
+    }
+    Port_Sim_StopMeasurement(&measurement);
+    printf("%u %-53s %11u\n", (unsigned)PORT_BENCH_APERTURE_ROUNDS, "round trips of Port_SwitchConfiguration to heavy-AF", (unsigned)measurement.busCycles);
+#endif
+}
+
+int main(void)
+{
+    uint32 violations = 0;
+    uint32 count;
+    uint8 profile;
+    uint8 repeat;
+
+    Port_Bench_OpenBranchCounter();
+
+    /* Branches of the counter itself, measured around nothing */
+    Port_Bench_BranchOverhead = PORT_BENCH_NO_BRANCHES;
+    for (repeat = 0; repeat < PORT_BENCH_REPEATS; repeat++)
+    {
+        Port_Bench_StartBranches();
+        count = Port_Bench_StopBranches();
+        Port_Bench_BranchOverhead = (count < Port_Bench_BranchOverhead) ? count : Port_Bench_BranchOverhead;
+    }
+
+    printf("Worst call of each API over PA0..PF4, ns and branches are the shortest of %u repeats\n", (unsigned)PORT_BENCH_REPEATS);
+    for (profile = 0; profile < PORT_BENCH_NUMBER_OF_PROFILES; profile++)
+    {
+        violations += Port_Bench_RunProfile(&Port_Bench_Profiles[profile]);
+    }
+    Port_Bench_RunAperture();
+
+    printf("\n%u budget violations\n", (unsigned)violations);
+    return (violations == 0) ? 0 : 1;
+}
+
+#endif /* PORT_HOST_BACKEND == STD_ON */
@@ -38,9 +38,73 @@
 /* Pre-compile option for Version Info API */
 #define PORT_VERSION_INFO_API (STD_OFF)
 
+/* Pre-compile option for Init Statistics API */
+#define PORT_INIT_STATISTICS_API (STD_ON)
+
+/* Pre-compile option for Init Port API, Port_Init then initializes only the early ports of the configuration */
+#ifndef PORT_INIT_PORT_API
+#define PORT_INIT_PORT_API (STD_OFF)
+#endif
+
+/* Pre-compile option for Switch Configuration API */
+#define PORT_SWITCH_CONFIGURATION_API (STD_ON)
+
+/* Pre-compile option for Init Image API, initialization from a post-build configuration image */
+#define PORT_INIT_IMAGE_API (STD_ON)
+
+/* Pre-compile option for Begin Update and Commit Update APIs, batching direction and mode changes */
+#define PORT_UPDATE_TRANSACTION_API (STD_ON)
+
+/* Pre-compile option for Verify Configuration API, the periodic check of the configuration registers */
+#define PORT_VERIFY_CONFIGURATION_API (STD_ON)
+
+/* Pre-compile option for Snapshot and Diff Snapshots APIs, captures of the GPIO registers for logging */
+#define PORT_SNAPSHOT_API (STD_ON)
+
+/* Pre-compile option for call counters and cycle histograms of Port_Init, Port_SetPinDirection,
+ * Port_SetPinMode and Port_RefreshPortDirection */
+#ifndef PORT_INSTRUMENTATION
+#define PORT_INSTRUMENTATION (STD_OFF)
+#endif
+
+/* Pre-compile option for recording every register access of the Port Driver in a trace buffer */
+#ifndef PORT_TRACE
+#define PORT_TRACE (STD_OFF)
+#endif
+
+/* Pre-compile option for direction drift detection in Port_RefreshPortDirection */
+#define PORT_REFRESH_DRIFT_DETECTION (STD_ON)
+
+/* Pre-compile option for single pin register updates through the peripheral bit-band alias region */
+#ifndef PORT_BIT_BAND_ACCESS
+#define PORT_BIT_BAND_ACCESS (STD_OFF)
+#endif
+
+/* Pre-compile option for RAM shadows of the GPIO configuration registers, updated with plain stores
+ * so the driver reads them only in Port_ResyncShadowRegisters and the drift check of the refresh */
+#ifndef PORT_SHADOW_REGISTERS
+#define PORT_SHADOW_REGISTERS (STD_OFF)
+#endif
+
+/* Pre-compile option for GPIO register accesses through the Advanced High-performance Bus aperture */
+#ifndef PORT_AHB_APERTURE
+#define PORT_AHB_APERTURE (STD_OFF)
+#endif
+
+/* Pre-compile option for the simulated register file backend used by host builds */
+#ifndef PORT_HOST_BACKEND
+#define PORT_HOST_BACKEND (STD_OFF)
+#endif
+
 /* Number of pins in the MCU */
 #define PORT_NUMBER_OF_PINS (43U)
 
+/* Number of ports in the MCU */
+#define PORT_NUMBER_OF_PORTS (6U)
+
+/* Mask with one bit set for every port of the MCU */
+#define PORT_ALL_PORTS_MASK (0x3FU)
+
 /* MCU Port Definitions */
 #define PORT_PortA (0U)
 #define PORT_PortB (1U)
@@ -62,8 +126,9 @@
 /* Definitions for each alternate function mode*/
 /* GPIO Mode value = 0 */
 #define GPIO_MODE 0
-/* ADC (Analog) Mode value = 1 */
-#define ADC_MODE  1U
+/* ADC (Analog) Mode, no alternate function has this value so it keeps its own bit in the allowed
+ * modes bitmaps. The PMCx field of an analog pin is written 0 */
+#define ADC_MODE  10U
 /* Value = 1 */
 #define PA0_U0Rx  1U
 #define PA1_U0Tx  1U
@@ -198,10 +263,83 @@
 /* Value = 9 */
 #define PF0_C0o  9U
 #define PF1_C1o  9U
-/* No modes with values 10-13 */
+/* No alternate functions with values 10-13, 10 is ADC_MODE */
 /* Value = 14 */
 #define PF1_TRD1  14U
 #define PF2_TRD0  14U
 #define PF3_TRCLK  14U
 
+/* Number of mode values, the PMCx field of a pin is 4 bits wide */
+#define PORT_NUMBER_OF_PIN_MODES (16U)
+
+/* Bit of a mode value in the allowed modes bitmaps */
+#define PORT_MODE_BIT(MODE) (1U << (MODE))
+
+/*
+ * Allowed modes of each pin, one bit per mode value: GPIO_MODE, ADC_MODE for the pins
+ * with an analog signal in the datasheet (ADC inputs, analog comparator inputs and USB
+ * analog signals, all selected through AMSEL) and the alternate functions above.
+ */
+#define PORT_PA0_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PA0_U0Rx) | PORT_MODE_BIT(PA0_CAN1Rx))
+#define PORT_PA1_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PA1_U0Tx) | PORT_MODE_BIT(PA1_CAN1Tx))
+#define PORT_PA2_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PA2_SSI0Clk))
+#define PORT_PA3_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PA3_SSI0Fss))
+#define PORT_PA4_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PA4_SSI0Rx))
+#define PORT_PA5_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PA5_SSI0Tx))
+#define PORT_PA6_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PA6_I2C1SCL) | PORT_MODE_BIT(PA6_M1PWM2))
+#define PORT_PA7_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PA7_I2C1SDA) | PORT_MODE_BIT(PA7_M1PWM3))
+
+/* Analog signals: PB0 USB0ID, PB1 USB0VBUS, PB4 AIN10, PB5 AIN11 */
+#define PORT_PB0_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PB0_U1Rx) | PORT_MODE_BIT(PB0_T2CCP0))
+#define PORT_PB1_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PB1_U1Tx) | PORT_MODE_BIT(PB1_T2CCP1))
+#define PORT_PB2_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PB2_I2C0SCL) | PORT_MODE_BIT(PB2_T3CCP0))
+#define PORT_PB3_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PB3_I2C0SDA) | PORT_MODE_BIT(PB3_T3CCP1))
+#define PORT_PB4_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PB4_SSI2Clk) | PORT_MODE_BIT(PB4_M0PWM2) | PORT_MODE_BIT(PB4_T1CCP0) | PORT_MODE_BIT(PB4_CAN0Rx))
+#define PORT_PB5_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PB5_SSI2Fss) | PORT_MODE_BIT(PB5_M0PWM3) | PORT_MODE_BIT(PB5_T1CCP1) | PORT_MODE_BIT(PB5_CAN0Tx))
+#define PORT_PB6_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PB6_SSI2Rx) | PORT_MODE_BIT(PB6_M0PWM0) | PORT_MODE_BIT(PB6_T0CCP0))
+#define PORT_PB7_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PB7_SSI2Tx) | PORT_MODE_BIT(PB7_M0PWM1) | PORT_MODE_BIT(PB7_T0CCP1))
+
+/* PC0-PC3 are the JTAG TCK, TMS, TDI and TDO pins, left to the debugger, so only GPIO_MODE is listed.
+ * Analog signals: PC4 C1-, PC5 C1+, PC6 C0+, PC7 C0- */
+#define PORT_PC0_MODES (PORT_MODE_BIT(GPIO_MODE))
+#define PORT_PC1_MODES (PORT_MODE_BIT(GPIO_MODE))
+#define PORT_PC2_MODES (PORT_MODE_BIT(GPIO_MODE))
+#define PORT_PC3_MODES (PORT_MODE_BIT(GPIO_MODE))
+#define PORT_PC4_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PC4_U4Rx) | PORT_MODE_BIT(PC4_U1Rx) | PORT_MODE_BIT(PC4_M0PWM6) | PORT_MODE_BIT(PC4_IDX1) | PORT_MODE_BIT(PC4_WT0CCP0) | PORT_MODE_BIT(PC4_U1RTS))
+#define PORT_PC5_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PC5_U4Tx) | PORT_MODE_BIT(PC5_U1Tx) | PORT_MODE_BIT(PC5_M0PWM7) | PORT_MODE_BIT(PC5_PhA1) | PORT_MODE_BIT(PC5_WT0CCP1) | PORT_MODE_BIT(PC5_U1CTS))
+#define PORT_PC6_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PC6_U3Rx) | PORT_MODE_BIT(PC6_PhB1) | PORT_MODE_BIT(PC6_WT1CCP0) | PORT_MODE_BIT(PC6_USB0EPEN))
+#define PORT_PC7_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PC7_U4Tx) | PORT_MODE_BIT(PC7_WT1CCP1) | PORT_MODE_BIT(PC7_USB0PFLT))
+
+/* Analog signals: PD0-PD3 AIN7-AIN4, PD4 USB0DM, PD5 USB0DP */
+#define PORT_PD0_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PD0_SSI3Clk) | PORT_MODE_BIT(PD0_SSI1Clk) | PORT_MODE_BIT(PD0_I2C3SCL) | PORT_MODE_BIT(PD0_M0PWM6) | PORT_MODE_BIT(PD0_M1PWM0) | PORT_MODE_BIT(PD0_WT2CCP0))
+#define PORT_PD1_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PD1_SSI3Fss) | PORT_MODE_BIT(PD1_SSI1Fss) | PORT_MODE_BIT(PD1_I2C3SDA) | PORT_MODE_BIT(PD1_M0PWM7) | PORT_MODE_BIT(PD1_M1PWM1) | PORT_MODE_BIT(PD1_WT2CCP1))
+#define PORT_PD2_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PD2_SSI3Rx) | PORT_MODE_BIT(PD2_SSI1Rx) | PORT_MODE_BIT(PD2_M0FAULT0) | PORT_MODE_BIT(PD2_WT3CCP0) | PORT_MODE_BIT(PD2_USB0EPEN))
+#define PORT_PD3_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PD3_SSI3Tx) | PORT_MODE_BIT(PD3_SSI1Tx) | PORT_MODE_BIT(PD3_IDX0) | PORT_MODE_BIT(PD3_WT3CCP1) | PORT_MODE_BIT(PD3_USB0PFLT))
+#define PORT_PD4_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PD4_U6Rx) | PORT_MODE_BIT(PD4_WT4CCP0))
+#define PORT_PD5_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PD5_U6Tx) | PORT_MODE_BIT(PD5_WT4CCP1))
+#define PORT_PD6_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PD6_U2Rx) | PORT_MODE_BIT(PD6_M0FAULT0) | PORT_MODE_BIT(PD6_PhA0) | PORT_MODE_BIT(PD6_WT5CCP0))
+#define PORT_PD7_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PD7_U2Tx) | PORT_MODE_BIT(PD7_PhB0) | PORT_MODE_BIT(PD7_WT5CCP1) | PORT_MODE_BIT(PD7_NMI))
+
+/* Analog signals: PE0-PE3 AIN3-AIN0, PE4 AIN9, PE5 AIN8 */
+#define PORT_PE0_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PE0_U7Rx))
+#define PORT_PE1_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PE1_U7Tx))
+#define PORT_PE2_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE))
+#define PORT_PE3_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE))
+#define PORT_PE4_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PE4_U5Rx) | PORT_MODE_BIT(PE4_I2C2SCL) | PORT_MODE_BIT(PE4_M0PWM4) | PORT_MODE_BIT(PE4_M1PWM2) | PORT_MODE_BIT(PE4_CAN0Rx))
+#define PORT_PE5_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(ADC_MODE) | PORT_MODE_BIT(PE5_U5Tx) | PORT_MODE_BIT(PE5_I2C2SDA) | PORT_MODE_BIT(PE5_M0PWM5) | PORT_MODE_BIT(PE5_M1PWM3) | PORT_MODE_BIT(PE5_CAN0Tx))
+
+#define PORT_PF0_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PF0_U1RTS) | PORT_MODE_BIT(PF0_SSI1Rx) | PORT_MODE_BIT(PF0_CAN0Rx) | PORT_MODE_BIT(PF0_M1PWM4) | PORT_MODE_BIT(PF0_PhA0) | PORT_MODE_BIT(PF0_T0CCP0) | PORT_MODE_BIT(PF0_NMI) | PORT_MODE_BIT(PF0_C0o))
+#define PORT_PF1_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PF1_U1CTS) | PORT_MODE_BIT(PF1_SSI1Tx) | PORT_MODE_BIT(PF1_M1PWM5) | PORT_MODE_BIT(PF1_PhB0) | PORT_MODE_BIT(PF1_T0CCP1) | PORT_MODE_BIT(PF1_C1o) | PORT_MODE_BIT(PF1_TRD1))
+#define PORT_PF2_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PF2_SSI1Clk) | PORT_MODE_BIT(PF2_M0FAULT0) | PORT_MODE_BIT(PF2_M1PWM6) | PORT_MODE_BIT(PF2_T1CCP0) | PORT_MODE_BIT(PF2_TRD0))
+#define PORT_PF3_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PF3_SSI1Fss) | PORT_MODE_BIT(PF3_CAN0Tx) | PORT_MODE_BIT(PF3_M1PWM7) | PORT_MODE_BIT(PF3_T1CCP1) | PORT_MODE_BIT(PF3_TRCLK))
+#define PORT_PF4_MODES (PORT_MODE_BIT(GPIO_MODE) | PORT_MODE_BIT(PF4_M1FAULT0) | PORT_MODE_BIT(PF4_IDX0) | PORT_MODE_BIT(PF4_T2CCP0) | PORT_MODE_BIT(PF4_USB0EPEN))
+
+/* Modes allowed on every pin of each port, for the default configuration of the pins not in use */
+#define PORT_PORTA_MODES (PORT_PA0_MODES & PORT_PA1_MODES & PORT_PA2_MODES & PORT_PA3_MODES & PORT_PA4_MODES & PORT_PA5_MODES & PORT_PA6_MODES & PORT_PA7_MODES)
+#define PORT_PORTB_MODES (PORT_PB0_MODES & PORT_PB1_MODES & PORT_PB2_MODES & PORT_PB3_MODES & PORT_PB4_MODES & PORT_PB5_MODES & PORT_PB6_MODES & PORT_PB7_MODES)
+#define PORT_PORTC_MODES (PORT_PC0_MODES & PORT_PC1_MODES & PORT_PC2_MODES & PORT_PC3_MODES & PORT_PC4_MODES & PORT_PC5_MODES & PORT_PC6_MODES & PORT_PC7_MODES)
+#define PORT_PORTD_MODES (PORT_PD0_MODES & PORT_PD1_MODES & PORT_PD2_MODES & PORT_PD3_MODES & PORT_PD4_MODES & PORT_PD5_MODES & PORT_PD6_MODES & PORT_PD7_MODES)
+#define PORT_PORTE_MODES (PORT_PE0_MODES & PORT_PE1_MODES & PORT_PE2_MODES & PORT_PE3_MODES & PORT_PE4_MODES & PORT_PE5_MODES)
+#define PORT_PORTF_MODES (PORT_PF0_MODES & PORT_PF1_MODES & PORT_PF2_MODES & PORT_PF3_MODES & PORT_PF4_MODES)
+
 #endif /* PORT_CFG_H */
@@ -0,0 +1,39 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Image.h
+ *
+ * Description: Header file for the CRC of the post-build configuration images of the Port Driver and their host builder.
+ *
+ * Author: Ammar Moataz
+ ******************************************************************************/
+
+#ifndef PORT_IMAGE_H
+#define PORT_IMAGE_H
+
+#include "Port.h"
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+#if (PORT_INIT_IMAGE_API == STD_ON)
+
+/* Returns the CRC-32 (IEEE 802.3, reflected, initial value and final XOR 0xFFFFFFFF) of a block of bytes */
+uint32 Port_ImageCrc32(const uint8 *Data, uint32 Length);
+
+#if (PORT_HOST_BACKEND == STD_ON)
+
+#include <stdio.h>
+
+/* Builds the post-build configuration image of a configuration set, returns its size in bytes or 0 when it does not fit */
+uint16 Port_ImageTool_Build(const Port_ConfigType *ConfigPtr, uint32 *Buffer, uint16 BufferSize);
+
+/* Builds the post-build configuration image of a configuration set and writes it to a binary stream */
+Std_ReturnType Port_ImageTool_Write(const Port_ConfigType *ConfigPtr, FILE *Stream);
+
+#endif
+
+#endif
+
+#endif /* PORT_IMAGE_H */
@@ -0,0 +1,63 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_ImageTool.c
+ *
+ * Description: Host program writing the post-build configuration image of the configuration set in
+ *              Port_PBcfg.c to a binary file, to be flashed separately from the application and
+ *              passed to Port_InitImage. The program exits with a non-zero status when the image
+ *              could not be written.
+ *
+ * Author: Ammar Moataz
+ ******************************************************************************/
+
+#include "Port.h"
+#include "Port_Image.h"
+
+#if ((PORT_HOST_BACKEND == STD_ON) && (PORT_INIT_IMAGE_API == STD_ON))
+
+#include <stdio.h>
+
+/* File written when no file name is given on the command line */
+#define PORT_IMAGE_TOOL_DEFAULT_FILE    "Port_PBcfg.bin"
+
+int main(int argc, char *argv[])
+{
+    const char *fileName = (argc > 1) ? argv[1] : PORT_IMAGE_TOOL_DEFAULT_FILE;
+    FILE *stream = fopen(fileName, "wb");
+    Std_ReturnType result;
+
+    if (NULL_PTR == stream)
+    {
+        fprintf(stderr, "cannot open %s\n", fileName);
+        return 1;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    result = Port_ImageTool_Write(&Port_PinConfigArray, stream);
+    if (fclose(stream) != 0)
+    {
+        result = E_NOT_OK;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    if (result != E_OK)
+    {
+        fprintf(stderr, "cannot write the image to %s\n", fileName);
+        return 1;
+    }
+    else
+    {
+        printf("image of Port_PinConfigArray written to %s\n", fileName);
+        return 0;
+    }
+}
+
+#endif /* (PORT_HOST_BACKEND == STD_ON) && (PORT_INIT_IMAGE_API == STD_ON) */
@@ -14,17 +14,45 @@
 
 #include "Std_Types.h"
 
+/* Port Pre-Compile Configuration Header file */
+#include "Port_Cfg.h"
+
 /*******************************************************************************
  *                              Module Definitions                             *
  *******************************************************************************/
 
-/* GPIO Registers base addresses */
-#define GPIO_PORTA_BASE_ADDRESS           0x40004000
-#define GPIO_PORTB_BASE_ADDRESS           0x40005000
-#define GPIO_PORTC_BASE_ADDRESS           0x40006000
-#define GPIO_PORTD_BASE_ADDRESS           0x40007000
-#define GPIO_PORTE_BASE_ADDRESS           0x40024000
-#define GPIO_PORTF_BASE_ADDRESS           0x40025000
+/* GPIO Registers base addresses on the Advanced Peripheral Bus */
+#define GPIO_PORTA_APB_BASE_ADDRESS       0x40004000
+#define GPIO_PORTB_APB_BASE_ADDRESS       0x40005000
+#define GPIO_PORTC_APB_BASE_ADDRESS       0x40006000
+#define GPIO_PORTD_APB_BASE_ADDRESS       0x40007000
+#define GPIO_PORTE_APB_BASE_ADDRESS       0x40024000
+#define GPIO_PORTF_APB_BASE_ADDRESS       0x40025000
+
+/* GPIO Registers base addresses on the Advanced High-performance Bus */
+#define GPIO_PORTA_AHB_BASE_ADDRESS       0x40058000
+#define GPIO_PORTB_AHB_BASE_ADDRESS       0x40059000
+#define GPIO_PORTC_AHB_BASE_ADDRESS       0x4005A000
+#define GPIO_PORTD_AHB_BASE_ADDRESS       0x4005B000
+#define GPIO_PORTE_AHB_BASE_ADDRESS       0x4005C000
+#define GPIO_PORTF_AHB_BASE_ADDRESS       0x4005D000
+
+/* GPIO Registers base addresses of the aperture used by the driver */
+#if (PORT_AHB_APERTURE == STD_ON)
+#define GPIO_PORTA_BASE_ADDRESS           GPIO_PORTA_AHB_BASE_ADDRESS
+#define GPIO_PORTB_BASE_ADDRESS           GPIO_PORTB_AHB_BASE_ADDRESS
+#define GPIO_PORTC_BASE_ADDRESS           GPIO_PORTC_AHB_BASE_ADDRESS
+#define GPIO_PORTD_BASE_ADDRESS           GPIO_PORTD_AHB_BASE_ADDRESS
+#define GPIO_PORTE_BASE_ADDRESS           GPIO_PORTE_AHB_BASE_ADDRESS
+#define GPIO_PORTF_BASE_ADDRESS           GPIO_PORTF_AHB_BASE_ADDRESS
+#else
+#define GPIO_PORTA_BASE_ADDRESS           GPIO_PORTA_APB_BASE_ADDRESS
+#define GPIO_PORTB_BASE_ADDRESS           GPIO_PORTB_APB_BASE_ADDRESS
+#define GPIO_PORTC_BASE_ADDRESS           GPIO_PORTC_APB_BASE_ADDRESS
+#define GPIO_PORTD_BASE_ADDRESS           GPIO_PORTD_APB_BASE_ADDRESS
+#define GPIO_PORTE_BASE_ADDRESS           GPIO_PORTE_APB_BASE_ADDRESS
+#define GPIO_PORTF_BASE_ADDRESS           GPIO_PORTF_APB_BASE_ADDRESS
+#endif
 
 /* GPIO Registers offset addresses */
 #define PORT_DATA_REG_OFFSET              0x3FC
@@ -38,10 +66,89 @@
 #define PORT_ANALOG_MODE_SEL_REG_OFFSET   0x528
 #define PORT_CTL_REG_OFFSET               0x52C
 
-/* RCC Registers */
-#define SYSCTL_REGCGC2_REG        		(*((volatile uint32 *)0x400FE108))
+/* Address of the data register alias that reads and writes only the pins of MASK, address bits [9:2] select the pins */
+#define PORT_DATA_MASKED_ADDRESS(BASE, MASK) ((uint32)(BASE) + ((uint32)(MASK) << 2))
+
+/* RCC Registers addresses */
+#define SYSCTL_RCGC2_REG_ADDRESS          0x400FE108
+#define SYSCTL_RCGCGPIO_REG_ADDRESS       0x400FE608
+
+/* GPIO High-Performance Bus Control Register address, a set bit moves its port to the AHB aperture */
+#define SYSCTL_GPIOHBCTL_REG_ADDRESS      0x400FE06C
+
+/* Peripheral ready Registers addresses */
+#define SYSCTL_PRGPIO_REG_ADDRESS         0x400FEA08
+
+/* Debug registers addresses used to count the CPU cycles of the instrumented APIs */
+#define PORT_DEMCR_REG_ADDRESS            0xE000EDFC
+#define PORT_DWT_CTRL_REG_ADDRESS         0xE0001000
+#define PORT_DWT_CYCCNT_REG_ADDRESS       0xE0001004
+
+/* Trace enable bit of DEMCR and cycle counter enable bit of DWT_CTRL */
+#define PORT_DEMCR_TRCENA_MASK            0x01000000
+#define PORT_DWT_CTRL_CYCCNTENA_MASK      0x00000001
+
+/* Peripheral bit-band region and its alias region */
+#define PORT_PERIPHERAL_BASE_ADDRESS      0x40000000
+#define PORT_BIT_BAND_ALIAS_BASE_ADDRESS  0x42000000
+
+/* Address of the alias word of bit BIT of the peripheral register at ADDRESS */
+#define PORT_BIT_BAND_ADDRESS(ADDRESS, BIT) \
+    (PORT_BIT_BAND_ALIAS_BASE_ADDRESS + (((uint32)(ADDRESS) - PORT_PERIPHERAL_BASE_ADDRESS) * 32U) + ((uint32)(BIT) * 4U))
+
+/* Value written to the lock register to unlock the commit register */
+#define PORT_UNLOCK_VALUE                 0x4C4F434B
 
 /* PMCx bits mask */
 #define PMCx_BITS_MASK  0x0000000F
 
+/*******************************************************************************
+ *                         Register Access Macros                              *
+ *******************************************************************************/
+#if (PORT_HOST_BACKEND == STD_ON)
+
+/* Host builds access the simulated register file */
+#include "Port_Sim.h"
+
+#define PORT_RAW_READ_REG(ADDRESS)        Port_Sim_ReadRegister((uint32)(ADDRESS))
+#define PORT_RAW_WRITE_REG(ADDRESS, VALUE) Port_Sim_WriteRegister((uint32)(ADDRESS), (uint32)(VALUE))
+
+/* Reads a register without counting the access */
+#define PORT_PEEK_REG(ADDRESS)            Port_Sim_PeekRegister((uint32)(ADDRESS))
+
+/* Host builds count nanoseconds of the monotonic clock instead of CPU cycles */
+#define PORT_GET_CYCLES()                 Port_Sim_GetCycleCount()
+
+#else
+
+#define PORT_RAW_READ_REG(ADDRESS)        (*(volatile uint32 *)(ADDRESS))
+#define PORT_RAW_WRITE_REG(ADDRESS, VALUE) (*(volatile uint32 *)(ADDRESS) = (uint32)(VALUE))
+
+#define PORT_PEEK_REG(ADDRESS)            PORT_RAW_READ_REG(ADDRESS)
+
+#define PORT_GET_CYCLES()                 (*(volatile uint32 *)PORT_DWT_CYCCNT_REG_ADDRESS)
+
+#endif
+
+#if (PORT_TRACE == STD_ON)
+
+/* Traced builds record every access in the trace buffer */
+#include "Port_Trace.h"
+
+#define PORT_READ_REG(ADDRESS)            Port_TraceRead((uint32)(ADDRESS))
+#define PORT_WRITE_REG(ADDRESS, VALUE)    Port_TraceWrite((uint32)(ADDRESS), (uint32)(VALUE))
+
+#else
+
+#define PORT_READ_REG(ADDRESS)            PORT_RAW_READ_REG(ADDRESS)
+#define PORT_WRITE_REG(ADDRESS, VALUE)    PORT_RAW_WRITE_REG((ADDRESS), (VALUE))
+
+#endif
+
+/* Set the bits of MASK in the register at ADDRESS */
+#define PORT_SET_REG_BITS(ADDRESS, MASK)    PORT_WRITE_REG((ADDRESS), PORT_READ_REG(ADDRESS) | (MASK))
+
+/* Clear the bits of MASK in the register at ADDRESS */
+#define PORT_CLEAR_REG_BITS(ADDRESS, MASK)  PORT_WRITE_REG((ADDRESS), PORT_READ_REG(ADDRESS) & ~(MASK))
+
 #endif /* PORT_REGS_H */
\ No newline at end of file
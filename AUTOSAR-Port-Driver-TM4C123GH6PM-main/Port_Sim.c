@@ -0,0 +1,758 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Sim.c
+ *
+ * Description: Simulated TM4C123GH6PM GPIO and System Control register file used by host builds of the Port Driver.
+ *              Every access is counted per register, the lock/commit protection of PD7, PF0 and the JTAG pins
+ *              PC0-PC3 is enforced and accesses to clock gated ports are reported as faults. Stores and
+ *              loads through the peripheral bit-band alias region reach the aliased register bit.
+ *              Every port is mapped on both the APB and the AHB apertures, only the one selected by
+ *              GPIOHBCTL can be accessed.
+ *
+ * Author: Ammar Moataz
+ ******************************************************************************/
+
+/* clock_gettime() of POSIX.1b */
+#define _POSIX_C_SOURCE 199309L
+
+#include "Port_Sim.h"
+#include "Port_Sim_Budget.h"
+#include "Port.h"
+#include "Port_Regs.h"
+
+#if (PORT_HOST_BACKEND == STD_ON)
+
+#include <time.h>
+
+/* Block number of the System Control registers, the GPIO ports use the blocks 0 to 5 */
+#define PORT_SIM_SYSCTL_BLOCK             (PORT_NUMBER_OF_PORTS)
+
+/* Number of simulated register blocks */
+#define PORT_SIM_NUMBER_OF_BLOCKS         (PORT_NUMBER_OF_PORTS + 1U)
+
+/* Block number returned for addresses outside the simulated register blocks */
+#define PORT_SIM_UNMAPPED_BLOCK           (0xFFU)
+
+/* Register index inside its block */
+#define PORT_SIM_INDEX(OFFSET)            ((uint32)(OFFSET) >> 2)
+
+/* Registers indexes below the data register index are the address masked aliases of the data register */
+#define PORT_SIM_DATA_INDEX               PORT_SIM_INDEX(PORT_DATA_REG_OFFSET)
+
+/* Access counter of a register, the address masked aliases of a GPIO data register share its counter */
+#define PORT_SIM_COUNTER_INDEX(BLOCK, INDEX) \
+    ((((BLOCK) < PORT_NUMBER_OF_PORTS) && ((INDEX) < PORT_SIM_DATA_INDEX)) ? PORT_SIM_DATA_INDEX : (INDEX))
+
+/* Clock gating control registers indexes */
+#define PORT_SIM_RCGC2_INDEX              PORT_SIM_INDEX(SYSCTL_RCGC2_REG_ADDRESS - PORT_SIM_SYSCTL_BASE_ADDRESS)
+#define PORT_SIM_RCGCGPIO_INDEX           PORT_SIM_INDEX(SYSCTL_RCGCGPIO_REG_ADDRESS - PORT_SIM_SYSCTL_BASE_ADDRESS)
+
+/* GPIO High-Performance Bus Control register index */
+#define PORT_SIM_GPIOHBCTL_INDEX          PORT_SIM_INDEX(SYSCTL_GPIOHBCTL_REG_ADDRESS - PORT_SIM_SYSCTL_BASE_ADDRESS)
+
+/* Peripheral ready register index */
+#define PORT_SIM_PRGPIO_INDEX             PORT_SIM_INDEX(SYSCTL_PRGPIO_REG_ADDRESS - PORT_SIM_SYSCTL_BASE_ADDRESS)
+
+/* Ports whose clock is enabled by the legacy or the GPIO clock gating control register */
+#define PORT_SIM_CLOCKED_PORTS() \
+    (Port_Sim_Registers[PORT_SIM_SYSCTL_BLOCK][PORT_SIM_RCGC2_INDEX] | Port_Sim_Registers[PORT_SIM_SYSCTL_BLOCK][PORT_SIM_RCGCGPIO_INDEX])
+
+/* Size of the peripheral bit-band alias region, 32 words alias each word of the 1MB peripheral region */
+#define PORT_SIM_BIT_BAND_ALIAS_SIZE      (0x02000000U)
+
+/* Reset value of the commit register of the ports without protected pins */
+#define PORT_SIM_COMMIT_RESET_VALUE       (0xFFU)
+
+/* Value read from the lock register while the commit register is locked */
+#define PORT_SIM_LOCKED                   (1U)
+
+/* Value read from the lock register while the commit register is unlocked */
+#define PORT_SIM_UNLOCKED                 (0U)
+
+/* GPIO Registers APB base address of each port, indexed by the block number */
+STATIC const uint32 Port_Sim_ApbBaseAddress[PORT_NUMBER_OF_PORTS] = {
+    GPIO_PORTA_APB_BASE_ADDRESS,
+    GPIO_PORTB_APB_BASE_ADDRESS,
+    GPIO_PORTC_APB_BASE_ADDRESS,
+    GPIO_PORTD_APB_BASE_ADDRESS,
+    GPIO_PORTE_APB_BASE_ADDRESS,
+    GPIO_PORTF_APB_BASE_ADDRESS};
+
+/* GPIO Registers AHB base address of each port, indexed by the block number */
+STATIC const uint32 Port_Sim_AhbBaseAddress[PORT_NUMBER_OF_PORTS] = {
+    GPIO_PORTA_AHB_BASE_ADDRESS,
+    GPIO_PORTB_AHB_BASE_ADDRESS,
+    GPIO_PORTC_AHB_BASE_ADDRESS,
+    GPIO_PORTD_AHB_BASE_ADDRESS,
+    GPIO_PORTE_AHB_BASE_ADDRESS,
+    GPIO_PORTF_AHB_BASE_ADDRESS};
+
+/* Simulated registers and their access counters */
+STATIC uint32 Port_Sim_Registers[PORT_SIM_NUMBER_OF_BLOCKS][PORT_SIM_BLOCK_WORDS];
+STATIC uint32 Port_Sim_ReadCount[PORT_SIM_NUMBER_OF_BLOCKS][PORT_SIM_BLOCK_WORDS];
+STATIC uint32 Port_Sim_WriteCount[PORT_SIM_NUMBER_OF_BLOCKS][PORT_SIM_BLOCK_WORDS];
+STATIC uint32 Port_Sim_TotalReadCount = 0;
+STATIC uint32 Port_Sim_TotalWriteCount = 0;
+STATIC uint32 Port_Sim_FaultCount = 0;
+STATIC uint32 Port_Sim_BusCycleCount = 0;
+
+/* Addresses of the first register writes since the counters were cleared, in write order */
+STATIC uint32 Port_Sim_WriteLog[PORT_SIM_WRITE_LOG_SIZE];
+
+/* Counters and time at the start of the running measurement */
+STATIC uint32 Port_Sim_StartReadCount = 0;
+STATIC uint32 Port_Sim_StartWriteCount = 0;
+STATIC uint32 Port_Sim_StartFaultCount = 0;
+STATIC uint32 Port_Sim_StartBusCycleCount = 0;
+STATIC uint64 Port_Sim_StartTimeNs = 0;
+
+/* Description: Register access and latency budget of one API call */
+typedef struct
+{
+  uint8 apiId;
+  uint32 reads;
+  uint32 writes;
+  uint32 timeNs;
+} Port_Sim_BudgetType;
+
+/* Budgets of the Port APIs from Port_Sim_Budget.h */
+STATIC const Port_Sim_BudgetType Port_Sim_Budgets[] = {
+    {PORT_INIT_SID, PORT_BUDGET_INIT_READS, PORT_BUDGET_INIT_WRITES, PORT_BUDGET_INIT_TIME_NS},
+    {PORT_SET_PIN_DIRECTION_SID, PORT_BUDGET_SET_PIN_DIRECTION_READS, PORT_BUDGET_SET_PIN_DIRECTION_WRITES, PORT_BUDGET_SET_PIN_DIRECTION_TIME_NS},
+    {PORT_REFRESH_PORT_DIRECTION_SID, PORT_BUDGET_REFRESH_PORT_DIRECTION_READS, PORT_BUDGET_REFRESH_PORT_DIRECTION_WRITES, PORT_BUDGET_REFRESH_PORT_DIRECTION_TIME_NS},
+    {PORT_SET_PIN_MODE_SID, PORT_BUDGET_SET_PIN_MODE_READS, PORT_BUDGET_SET_PIN_MODE_WRITES, PORT_BUDGET_SET_PIN_MODE_TIME_NS},
+    {PORT_VERIFY_CONFIGURATION_SID, PORT_BUDGET_VERIFY_CONFIGURATION_READS, PORT_BUDGET_VERIFY_CONFIGURATION_WRITES, PORT_BUDGET_VERIFY_CONFIGURATION_TIME_NS},
+    {PORT_SNAPSHOT_SID, PORT_BUDGET_SNAPSHOT_READS, PORT_BUDGET_SNAPSHOT_WRITES, PORT_BUDGET_SNAPSHOT_TIME_NS}};
+
+/* Number of entries of Port_Sim_Budgets */
+#define PORT_SIM_NUMBER_OF_BUDGETS        (sizeof(Port_Sim_Budgets) / sizeof(Port_Sim_Budgets[0]))
+
+/* Levels driven by the outside world on the input pins of each port */
+STATIC uint8 Port_Sim_PinInputs[PORT_NUMBER_OF_PORTS];
+
+/************************************************************************************
+ * Function Name: Port_Sim_Decode
+ * Parameters (in): Address - Register address
+ * Parameters (inout): None
+ * Parameters (out): Index - Register index inside its block
+ * Return value: Block number of the register or PORT_SIM_UNMAPPED_BLOCK
+ * Description: Maps a register address to the simulated register file.
+ ************************************************************************************/
+STATIC uint8 Port_Sim_Decode(uint32 Address, uint32 *Index)
+{
+    uint32 blockAddress = Address & ~(uint32)0xFFF;
+    uint8 block;
+
+    *Index = PORT_SIM_INDEX(Address & 0xFFF);
+
+    /* Registers are only accessed as aligned words */
+    if ((Address & 0x3U) != 0)
+    {
+        return PORT_SIM_UNMAPPED_BLOCK;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+
+    for (block = PORT_PortA; block < PORT_NUMBER_OF_PORTS; block++)
+    {
+        if ((blockAddress == Port_Sim_ApbBaseAddress[block]) || (blockAddress == Port_Sim_AhbBaseAddress[block]))
+        {
+            return block;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    if (blockAddress == PORT_SIM_SYSCTL_BASE_ADDRESS)
+    {
+        return PORT_SIM_SYSCTL_BLOCK;
+    }
+    else
+    {
+        return PORT_SIM_UNMAPPED_BLOCK;
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_DecodeBitBand
+ * Parameters (in): None
+ * Parameters (inout): Address - Accessed address, replaced by the aliased register address
+ * Parameters (out): Bit - Aliased bit number
+ * Return value: TRUE if the address is in the peripheral bit-band alias region
+ * Description: Maps a bit-band alias word to the register and bit it aliases.
+ ************************************************************************************/
+STATIC boolean Port_Sim_DecodeBitBand(uint32 *Address, uint8 *Bit)
+{
+    uint32 aliasOffset = *Address - PORT_BIT_BAND_ALIAS_BASE_ADDRESS;
+
+    *Bit = 0;
+    if ((*Address >= PORT_BIT_BAND_ALIAS_BASE_ADDRESS) && (aliasOffset < PORT_SIM_BIT_BAND_ALIAS_SIZE))
+    {
+        *Bit = (uint8)((aliasOffset >> 2) & 0x1FU);
+        *Address = PORT_PERIPHERAL_BASE_ADDRESS + ((aliasOffset >> 5) & ~(uint32)0x3);
+        return TRUE;
+    }
+    else
+    {
+        return FALSE;
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_IsAhbAddress
+ * Parameters (in): Block - Block number of a GPIO port, Address - Register address
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: TRUE if the address is in the AHB aperture of the port
+ * Description: Tells through which aperture a GPIO register is accessed.
+ ************************************************************************************/
+STATIC boolean Port_Sim_IsAhbAddress(uint8 Block, uint32 Address)
+{
+    return ((Address & ~(uint32)0xFFF) == Port_Sim_AhbBaseAddress[Block]) ? TRUE : FALSE;
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_IsAccessible
+ * Parameters (in): Block - Block number of the register, Address - Register address
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: TRUE if the register can be accessed, FALSE if the access faults on the target
+ * Description: Checks that the register is mapped, that the clock of its port is enabled and
+ *              that it is accessed through the aperture selected for its port in GPIOHBCTL.
+ ************************************************************************************/
+STATIC boolean Port_Sim_IsAccessible(uint8 Block, uint32 Address)
+{
+    if (Block == PORT_SIM_UNMAPPED_BLOCK)
+    {
+        return FALSE;
+    }
+    else if (Block == PORT_SIM_SYSCTL_BLOCK)
+    {
+        return TRUE;
+    }
+    else if ((PORT_SIM_CLOCKED_PORTS() & (1U << Block)) == 0)
+    {
+        return FALSE;
+    }
+    else
+    {
+        boolean isAhbSelected = ((Port_Sim_Registers[PORT_SIM_SYSCTL_BLOCK][PORT_SIM_GPIOHBCTL_INDEX] & (1U << Block)) != 0) ? TRUE : FALSE;
+        return (Port_Sim_IsAhbAddress(Block, Address) == isAhbSelected) ? TRUE : FALSE;
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_CountBusCycles
+ * Parameters (in): Block - Block number of the register, Address - Register address
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Adds the modeled bus cycles of one access, only GPIO registers accessed
+ *              through the AHB aperture avoid the APB wait state.
+ ************************************************************************************/
+STATIC void Port_Sim_CountBusCycles(uint8 Block, uint32 Address)
+{
+    if ((Block < PORT_NUMBER_OF_PORTS) && (Port_Sim_IsAhbAddress(Block, Address) == TRUE))
+    {
+        Port_Sim_BusCycleCount += PORT_SIM_AHB_ACCESS_CYCLES;
+    }
+    else
+    {
+        Port_Sim_BusCycleCount += PORT_SIM_APB_ACCESS_CYCLES;
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_Load
+ * Parameters (in): Block - Block number of the register, Index - Register index inside its block
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Register value as read by the CPU
+ * Description: Returns the value of a register, the data register aliases return only the
+ *              pins selected by the address bits [9:2] and input pins return their levels.
+ ************************************************************************************/
+STATIC uint32 Port_Sim_Load(uint8 Block, uint32 Index)
+{
+    if ((Block < PORT_NUMBER_OF_PORTS) && (Index <= PORT_SIM_DATA_INDEX))
+    {
+        uint32 dir = Port_Sim_Registers[Block][PORT_SIM_INDEX(PORT_DIR_REG_OFFSET)];
+        uint32 data = Port_Sim_Registers[Block][PORT_SIM_DATA_INDEX];
+
+        return ((data & dir) | (Port_Sim_PinInputs[Block] & ~dir)) & Index;
+    }
+    /* Clocked ports are ready to be accessed right away */
+    else if ((Block == PORT_SIM_SYSCTL_BLOCK) && (Index == PORT_SIM_PRGPIO_INDEX))
+    {
+        return PORT_SIM_CLOCKED_PORTS() & ((1U << PORT_NUMBER_OF_PORTS) - 1U);
+    }
+    else
+    {
+        return Port_Sim_Registers[Block][Index];
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_Store
+ * Parameters (in): Block - Block number of the register, Index - Register index inside its block,
+ *                  Value - Value written by the CPU
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Updates a register applying the data register address masking and the
+ *              lock/commit protection of the port.
+ ************************************************************************************/
+STATIC void Port_Sim_Store(uint8 Block, uint32 Index, uint32 Value)
+{
+    uint32 *registers = Port_Sim_Registers[Block];
+
+    if (Block == PORT_SIM_SYSCTL_BLOCK)
+    {
+        registers[Index] = Value;
+    }
+    /* Address bits [9:2] select the data register bits to be written */
+    else if (Index <= PORT_SIM_DATA_INDEX)
+    {
+        registers[PORT_SIM_DATA_INDEX] = (registers[PORT_SIM_DATA_INDEX] & ~Index) | (Value & Index);
+    }
+    else if (Index == PORT_SIM_INDEX(PORT_LOCK_REG_OFFSET))
+    {
+        registers[Index] = (Value == PORT_UNLOCK_VALUE) ? PORT_SIM_UNLOCKED : PORT_SIM_LOCKED;
+    }
+    else if (Index == PORT_SIM_INDEX(PORT_COMMIT_REG_OFFSET))
+    {
+        /* The commit register can only be changed while the port is unlocked */
+        if (registers[PORT_SIM_INDEX(PORT_LOCK_REG_OFFSET)] == PORT_SIM_UNLOCKED)
+        {
+            registers[Index] = Value & 0xFFU;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+    else if ((Index == PORT_SIM_INDEX(PORT_ALT_FUNC_REG_OFFSET)) || (Index == PORT_SIM_INDEX(PORT_PULL_UP_REG_OFFSET)) || (Index == PORT_SIM_INDEX(PORT_PULL_DOWN_REG_OFFSET)) || (Index == PORT_SIM_INDEX(PORT_DIGITAL_ENABLE_REG_OFFSET)))
+    {
+        /* Only the committed bits of these registers can be changed */
+        uint32 commit = registers[PORT_SIM_INDEX(PORT_COMMIT_REG_OFFSET)];
+        registers[Index] = (registers[Index] & ~commit) | (Value & commit);
+    }
+    else
+    {
+        registers[Index] = Value;
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_Reset
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Puts every simulated register in its reset state and clears all the access counters.
+ ************************************************************************************/
+void Port_Sim_Reset(void)
+{
+    uint8 block;
+    uint32 index;
+
+    for (block = 0; block < PORT_SIM_NUMBER_OF_BLOCKS; block++)
+    {
+        for (index = 0; index < PORT_SIM_BLOCK_WORDS; index++)
+        {
+            Port_Sim_Registers[block][index] = 0;
+        }
+    }
+
+    for (block = PORT_PortA; block < PORT_NUMBER_OF_PORTS; block++)
+    {
+        Port_Sim_Registers[block][PORT_SIM_INDEX(PORT_LOCK_REG_OFFSET)] = PORT_SIM_LOCKED;
+        Port_Sim_Registers[block][PORT_SIM_INDEX(PORT_COMMIT_REG_OFFSET)] = PORT_SIM_COMMIT_RESET_VALUE;
+        Port_Sim_PinInputs[block] = 0;
+    }
+
+    /* PC0-PC3 leave reset as committed JTAG pins with their pull ups enabled */
+    Port_Sim_Registers[PORT_PortC][PORT_SIM_INDEX(PORT_COMMIT_REG_OFFSET)] = 0xF0U;
+    Port_Sim_Registers[PORT_PortC][PORT_SIM_INDEX(PORT_ALT_FUNC_REG_OFFSET)] = 0x0FU;
+    Port_Sim_Registers[PORT_PortC][PORT_SIM_INDEX(PORT_DIGITAL_ENABLE_REG_OFFSET)] = 0x0FU;
+    Port_Sim_Registers[PORT_PortC][PORT_SIM_INDEX(PORT_PULL_UP_REG_OFFSET)] = 0x0FU;
+    Port_Sim_Registers[PORT_PortC][PORT_SIM_INDEX(PORT_CTL_REG_OFFSET)] = 0x00001111U;
+
+    /* PD7 and PF0 leave reset uncommitted */
+    Port_Sim_Registers[PORT_PortD][PORT_SIM_INDEX(PORT_COMMIT_REG_OFFSET)] = 0x7FU;
+    Port_Sim_Registers[PORT_PortF][PORT_SIM_INDEX(PORT_COMMIT_REG_OFFSET)] = 0xFEU;
+
+    Port_Sim_ClearCounters();
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_ReadRegister
+ * Parameters (in): Address - Register address
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Register value
+ * Description: Reads a register as the driver does, counting the access.
+ ************************************************************************************/
+uint32 Port_Sim_ReadRegister(uint32 Address)
+{
+    uint32 index;
+    uint8 bit;
+    boolean isBitBand = Port_Sim_DecodeBitBand(&Address, &bit);
+    uint8 block = Port_Sim_Decode(Address, &index);
+
+    if (Port_Sim_IsAccessible(block, Address) == FALSE)
+    {
+        Port_Sim_FaultCount++;
+        return 0;
+    }
+    else
+    {
+        Port_Sim_ReadCount[block][PORT_SIM_COUNTER_INDEX(block, index)]++;
+        Port_Sim_TotalReadCount++;
+        Port_Sim_CountBusCycles(block, Address);
+        if (isBitBand == TRUE)
+        {
+            return (Port_Sim_Load(block, index) >> bit) & 1U;
+        }
+        else
+        {
+            return Port_Sim_Load(block, index);
+        }
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_WriteRegister
+ * Parameters (in): Address - Register address, Value - New register value
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Writes a register as the driver does, counting the access.
+ ************************************************************************************/
+void Port_Sim_WriteRegister(uint32 Address, uint32 Value)
+{
+    uint32 index;
+    uint8 bit;
+    boolean isBitBand = Port_Sim_DecodeBitBand(&Address, &bit);
+    uint8 block = Port_Sim_Decode(Address, &index);
+
+    if (Port_Sim_IsAccessible(block, Address) == FALSE)
+    {
+        Port_Sim_FaultCount++;
+    }
+    else
+    {
+        Port_Sim_WriteCount[block][PORT_SIM_COUNTER_INDEX(block, index)]++;
+        if (Port_Sim_TotalWriteCount < PORT_SIM_WRITE_LOG_SIZE)
+        {
+            Port_Sim_WriteLog[Port_Sim_TotalWriteCount] = Address;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+        Port_Sim_TotalWriteCount++;
+        Port_Sim_CountBusCycles(block, Address);
+        if (isBitBand == TRUE)
+        {
+            /* The bus changes only the aliased bit, bit 0 of the written value gives its new level */
+            Port_Sim_Store(block, index, (Port_Sim_Load(block, index) & ~(1U << bit)) | ((Value & 1U) << bit));
+        }
+        else
+        {
+            Port_Sim_Store(block, index, Value);
+        }
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_PeekRegister
+ * Parameters (in): Address - Register address
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Register value, 0 for unmapped addresses
+ * Description: Returns the current value of a register without counting the access.
+ ************************************************************************************/
+uint32 Port_Sim_PeekRegister(uint32 Address)
+{
+    uint32 index;
+    uint8 bit;
+    boolean isBitBand = Port_Sim_DecodeBitBand(&Address, &bit);
+    uint8 block = Port_Sim_Decode(Address, &index);
+
+    if (block == PORT_SIM_UNMAPPED_BLOCK)
+    {
+        return 0;
+    }
+    else if (isBitBand == TRUE)
+    {
+        return (Port_Sim_Load(block, index) >> bit) & 1U;
+    }
+    else
+    {
+        return Port_Sim_Load(block, index);
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_ClearCounters
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Clears the access counters without touching the register values.
+ ************************************************************************************/
+void Port_Sim_ClearCounters(void)
+{
+    uint8 block;
+    uint32 index;
+
+    for (block = 0; block < PORT_SIM_NUMBER_OF_BLOCKS; block++)
+    {
+        for (index = 0; index < PORT_SIM_BLOCK_WORDS; index++)
+        {
+            Port_Sim_ReadCount[block][index] = 0;
+            Port_Sim_WriteCount[block][index] = 0;
+        }
+    }
+    Port_Sim_TotalReadCount = 0;
+    Port_Sim_TotalWriteCount = 0;
+    Port_Sim_FaultCount = 0;
+    Port_Sim_BusCycleCount = 0;
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_GetReadCount
+ * Parameters (in): Address - Register address
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Number of reads of the register, the data register aliases are counted together
+ * Description: Returns the number of reads of the register at Address.
+ ************************************************************************************/
+uint32 Port_Sim_GetReadCount(uint32 Address)
+{
+    uint32 index;
+    uint8 block = Port_Sim_Decode(Address, &index);
+
+    return (block == PORT_SIM_UNMAPPED_BLOCK) ? 0 : Port_Sim_ReadCount[block][PORT_SIM_COUNTER_INDEX(block, index)];
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_GetWriteCount
+ * Parameters (in): Address - Register address
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Number of writes of the register, the data register aliases are counted together
+ * Description: Returns the number of writes of the register at Address.
+ ************************************************************************************/
+uint32 Port_Sim_GetWriteCount(uint32 Address)
+{
+    uint32 index;
+    uint8 block = Port_Sim_Decode(Address, &index);
+
+    return (block == PORT_SIM_UNMAPPED_BLOCK) ? 0 : Port_Sim_WriteCount[block][PORT_SIM_COUNTER_INDEX(block, index)];
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_GetTotalReadCount
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Number of reads of all registers
+ * Description: Returns the number of reads since the counters were cleared.
+ ************************************************************************************/
+uint32 Port_Sim_GetTotalReadCount(void)
+{
+    return Port_Sim_TotalReadCount;
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_GetTotalWriteCount
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Number of writes of all registers
+ * Description: Returns the number of writes since the counters were cleared.
+ ************************************************************************************/
+uint32 Port_Sim_GetTotalWriteCount(void)
+{
+    return Port_Sim_TotalWriteCount;
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_GetLoggedWrite
+ * Parameters (in): Index - Position of the write, 0 for the first write since the counters were cleared
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Address of the register written, the bit-band aliases give the register they alias,
+ *               0 when the write was not made or is past the end of the log
+ * Description: Returns the register written by one of the first writes since the counters were cleared,
+ *              to check the order of the writes of a driver call.
+ ************************************************************************************/
+uint32 Port_Sim_GetLoggedWrite(uint32 Index)
+{
+    if ((Index < Port_Sim_TotalWriteCount) && (Index < PORT_SIM_WRITE_LOG_SIZE))
+    {
+        return Port_Sim_WriteLog[Index];
+    }
+    else
+    {
+        return 0;
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_GetFaultCount
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Number of faulting accesses
+ * Description: Returns the number of accesses to unmapped or clock gated registers,
+ *              which would raise a bus fault on the target.
+ ************************************************************************************/
+uint32 Port_Sim_GetFaultCount(void)
+{
+    return Port_Sim_FaultCount;
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_GetBusCycleCount
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Modeled bus cycles of all register accesses
+ * Description: Returns the bus cycles of the accesses since the counters were cleared,
+ *              see PORT_SIM_APB_ACCESS_CYCLES and PORT_SIM_AHB_ACCESS_CYCLES.
+ ************************************************************************************/
+uint32 Port_Sim_GetBusCycleCount(void)
+{
+    return Port_Sim_BusCycleCount;
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_SetPinInputs
+ * Parameters (in): PortNumber - Port number, Levels - Level of each pin of the port
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the levels driven by the outside world on the pins of a port,
+ *              they are returned by data register reads of the input pins.
+ ************************************************************************************/
+void Port_Sim_SetPinInputs(uint8 PortNumber, uint8 Levels)
+{
+    if (PortNumber < PORT_NUMBER_OF_PORTS)
+    {
+        Port_Sim_PinInputs[PortNumber] = Levels;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_GetTimeNs
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Monotonic host time in nanoseconds
+ * Description: Reads the monotonic clock of the host.
+ ************************************************************************************/
+STATIC uint64 Port_Sim_GetTimeNs(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64)now.tv_sec * 1000000000ULL) + (uint64)now.tv_nsec;
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_GetCycleCount
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Low 32 bits of the monotonic host time in nanoseconds
+ * Description: Stands for the DWT cycle counter of the target, it wraps the same way.
+ ************************************************************************************/
+uint32 Port_Sim_GetCycleCount(void)
+{
+    return (uint32)Port_Sim_GetTimeNs();
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_StartMeasurement
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Starts measuring the register accesses and wall time of the following driver calls.
+ ************************************************************************************/
+void Port_Sim_StartMeasurement(void)
+{
+    Port_Sim_StartReadCount = Port_Sim_TotalReadCount;
+    Port_Sim_StartWriteCount = Port_Sim_TotalWriteCount;
+    Port_Sim_StartFaultCount = Port_Sim_FaultCount;
+    Port_Sim_StartBusCycleCount = Port_Sim_BusCycleCount;
+    Port_Sim_StartTimeNs = Port_Sim_GetTimeNs();
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_StopMeasurement
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): Measurement - Accesses and wall time since Port_Sim_StartMeasurement
+ * Return value: None
+ * Description: Stops the measurement started by Port_Sim_StartMeasurement.
+ ************************************************************************************/
+void Port_Sim_StopMeasurement(Port_Sim_MeasurementType *Measurement)
+{
+    uint64 stopTimeNs = Port_Sim_GetTimeNs();
+
+    Measurement->reads = Port_Sim_TotalReadCount - Port_Sim_StartReadCount;
+    Measurement->writes = Port_Sim_TotalWriteCount - Port_Sim_StartWriteCount;
+    Measurement->faults = Port_Sim_FaultCount - Port_Sim_StartFaultCount;
+    Measurement->busCycles = Port_Sim_BusCycleCount - Port_Sim_StartBusCycleCount;
+    Measurement->elapsedNs = stopTimeNs - Port_Sim_StartTimeNs;
+}
+
+/************************************************************************************
+ * Function Name: Port_Sim_CheckBudget
+ * Parameters (in): ApiId - Service ID of the measured API, Measurement - Cost of one call of the API
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: E_OK if the call stayed within its budget,
+ *               E_NOT_OK if it exceeded it, faulted or the API has no budget
+ * Description: Checks a measurement of one API call against its budget in Port_Sim_Budget.h.
+ ************************************************************************************/
+Std_ReturnType Port_Sim_CheckBudget(uint8 ApiId, const Port_Sim_MeasurementType *Measurement)
+{
+    uint8 index;
+
+    for (index = 0; index < PORT_SIM_NUMBER_OF_BUDGETS; index++)
+    {
+        if (Port_Sim_Budgets[index].apiId == ApiId)
+        {
+            if ((Measurement->reads > Port_Sim_Budgets[index].reads) || (Measurement->writes > Port_Sim_Budgets[index].writes) || (Measurement->faults != 0) || (Measurement->elapsedNs > Port_Sim_Budgets[index].timeNs))
+            {
+                return E_NOT_OK;
+            }
+            else
+            {
+                return E_OK;
+            }
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    return E_NOT_OK;
+}
+
+#endif /* PORT_HOST_BACKEND == STD_ON */
@@ -0,0 +1,111 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Sim.h
+ *
+ * Description: Header file for the simulated TM4C123GH6PM register file used by host builds of the Port Driver.
+ *
+ * Author: Ammar Moataz
+ ******************************************************************************/
+
+#ifndef PORT_SIM_H
+#define PORT_SIM_H
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* Base address of the System Control registers block */
+#define PORT_SIM_SYSCTL_BASE_ADDRESS      0x400FE000
+
+/* Number of 32-bit registers simulated in every 4KB register block */
+#define PORT_SIM_BLOCK_WORDS              (1024U)
+
+/* Modeled bus cycles of one register access through each aperture, the APB inserts a wait state
+ * on every access while the AHB supports back-to-back accesses */
+#define PORT_SIM_APB_ACCESS_CYCLES        (2U)
+#define PORT_SIM_AHB_ACCESS_CYCLES        (1U)
+
+/* Number of register writes recorded in order after the counters are cleared */
+#define PORT_SIM_WRITE_LOG_SIZE           (64U)
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: Cost of the driver code run between Port_Sim_StartMeasurement and Port_Sim_StopMeasurement.
+ *	1. Number of register reads.
+ *	2. Number of register writes.
+ *	3. Number of faulting accesses.
+ *	4. Modeled bus cycles of the register accesses.
+ *	5. Host wall time in nanoseconds.
+ */
+typedef struct
+{
+  uint32 reads;
+  uint32 writes;
+  uint32 faults;
+  uint32 busCycles;
+  uint64 elapsedNs;
+} Port_Sim_MeasurementType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+
+/* Puts every simulated register in its reset state and clears all the access counters */
+void Port_Sim_Reset(void);
+
+/* Reads a register as the driver does, counting the access */
+uint32 Port_Sim_ReadRegister(uint32 Address);
+
+/* Writes a register as the driver does, counting the access */
+void Port_Sim_WriteRegister(uint32 Address, uint32 Value);
+
+/* Returns the current value of a register, or of a bit-band alias word, without counting the access */
+uint32 Port_Sim_PeekRegister(uint32 Address);
+
+/* Clears the access counters without touching the register values */
+void Port_Sim_ClearCounters(void);
+
+/* Returns the number of reads of the register at Address */
+uint32 Port_Sim_GetReadCount(uint32 Address);
+
+/* Returns the number of writes of the register at Address */
+uint32 Port_Sim_GetWriteCount(uint32 Address);
+
+/* Returns the number of reads of all registers */
+uint32 Port_Sim_GetTotalReadCount(void);
+
+/* Returns the number of writes of all registers */
+uint32 Port_Sim_GetTotalWriteCount(void);
+
+/* Returns the address of the Index-th register write since the counters were cleared */
+uint32 Port_Sim_GetLoggedWrite(uint32 Index);
+
+/* Returns the number of accesses that would fault on the target (unmapped, clock gated or through the wrong aperture) */
+uint32 Port_Sim_GetFaultCount(void);
+
+/* Returns the modeled bus cycles of all register accesses */
+uint32 Port_Sim_GetBusCycleCount(void);
+
+/* Sets the levels driven by the outside world on the pins of a port */
+void Port_Sim_SetPinInputs(uint8 PortNumber, uint8 Levels);
+
+/* Returns a free running count of nanoseconds of the host monotonic clock, standing for the CPU cycle counter */
+uint32 Port_Sim_GetCycleCount(void);
+
+/* Starts measuring the register accesses and wall time of the following driver calls */
+void Port_Sim_StartMeasurement(void);
+
+/* Stops the measurement started by Port_Sim_StartMeasurement */
+void Port_Sim_StopMeasurement(Port_Sim_MeasurementType *Measurement);
+
+/* Checks a measurement of one call of the API ApiId against its budget in Port_Sim_Budget.h */
+Std_ReturnType Port_Sim_CheckBudget(uint8 ApiId, const Port_Sim_MeasurementType *Measurement);
+
+#endif /* PORT_SIM_H */
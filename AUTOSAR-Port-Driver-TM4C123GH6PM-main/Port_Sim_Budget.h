@@ -0,0 +1,70 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Sim_Budget.h
+ *
+ * Description: Register access and latency budgets of every Port API call, checked on host builds.
+ *              The access budgets are the worst case of any configuration set, so a change that
+ *              makes an API touch more registers than allowed here is a performance regression.
+ *
+ * Author: Ammar Moataz
+ ******************************************************************************/
+
+#ifndef PORT_SIM_BUDGET_H
+#define PORT_SIM_BUDGET_H
+
+/* Pre-compile options the budgets depend on */
+#include "Port_Cfg.h"
+
+/* Port_Init: one clock gating write, ready polling, PD7/PF0 commit, 8 masked writes per port,
+ * and one more read-modify-write to move the ports to the AHB aperture */
+#if (PORT_AHB_APERTURE == STD_ON)
+#define PORT_BUDGET_INIT_READS                  (53U)
+#define PORT_BUDGET_INIT_WRITES                 (54U)
+#else
+#define PORT_BUDGET_INIT_READS                  (52U)
+#define PORT_BUDGET_INIT_WRITES                 (53U)
+#endif
+#define PORT_BUDGET_INIT_TIME_NS                (200000U)
+
+/* Port_SetPinDirection: one read-modify-write of the direction register, only the write with shadow registers */
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+#define PORT_BUDGET_SET_PIN_DIRECTION_READS     (0U)
+#else
+#define PORT_BUDGET_SET_PIN_DIRECTION_READS     (1U)
+#endif
+#define PORT_BUDGET_SET_PIN_DIRECTION_WRITES    (1U)
+#define PORT_BUDGET_SET_PIN_DIRECTION_TIME_NS   (20000U)
+
+/* Port_RefreshPortDirection: one read of the direction register per port. With drift detection the register
+ * is only rewritten when it drifted, which adds one write per drifted port, so the budget is the one of the
+ * benchmark, where no port has drifted. Without it every port gets a read-modify-write. */
+#define PORT_BUDGET_REFRESH_PORT_DIRECTION_READS    (6U)
+#if (PORT_REFRESH_DRIFT_DETECTION == STD_ON)
+#define PORT_BUDGET_REFRESH_PORT_DIRECTION_WRITES   (0U)
+#else
+#define PORT_BUDGET_REFRESH_PORT_DIRECTION_WRITES   (6U)
+#endif
+#define PORT_BUDGET_REFRESH_PORT_DIRECTION_TIME_NS  (20000U)
+
+/* Port_SetPinMode: DEN, AMSEL, AFSEL and PCTL read-modify-writes, only the writes with shadow registers */
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+#define PORT_BUDGET_SET_PIN_MODE_READS          (0U)
+#else
+#define PORT_BUDGET_SET_PIN_MODE_READS          (4U)
+#endif
+#define PORT_BUDGET_SET_PIN_MODE_WRITES         (4U)
+#define PORT_BUDGET_SET_PIN_MODE_TIME_NS        (20000U)
+
+/* Port_VerifyConfiguration: one read of the 7 compared registers per port, no writes */
+#define PORT_BUDGET_VERIFY_CONFIGURATION_READS  (42U)
+#define PORT_BUDGET_VERIFY_CONFIGURATION_WRITES (0U)
+#define PORT_BUDGET_VERIFY_CONFIGURATION_TIME_NS (10000U)
+
+/* Port_Snapshot: clock ready and aperture reads, then 9 register reads per clocked port, no writes */
+#define PORT_BUDGET_SNAPSHOT_READS              (56U)
+#define PORT_BUDGET_SNAPSHOT_WRITES             (0U)
+#define PORT_BUDGET_SNAPSHOT_TIME_NS            (10000U)
+
+#endif /* PORT_SIM_BUDGET_H */
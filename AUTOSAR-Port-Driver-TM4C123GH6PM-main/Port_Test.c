@@ -0,0 +1,1408 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Test.c
+ *
+ * Description: Host tests of the Port Driver. Every test runs the driver on the simulated register file
+ *              from reset and checks the resulting registers, the register accesses made and the
+ *              development errors reported. The program exits with a non-zero status when a check fails.
+ *
+ * Author: Ammar Moataz
+ ******************************************************************************/
+
+#include "Port.h"
+#include "Port_Regs.h"
+#include "Port_Sim.h"
+#include "Port_Sim_Budget.h"
+#include "Port_Image.h"
+#include "Det.h"
+#include "Dio.h"
+#include "Port_Trace.h"
+
+#if (PORT_HOST_BACKEND == STD_ON)
+
+#include <stdio.h>
+#include <string.h>
+
+/* Records one check, a failed check is printed with its location */
+#define PORT_TEST_CHECK(CONDITION) Port_Test_Check((CONDITION) ? TRUE : FALSE, #CONDITION, __LINE__)
+
+/* Value of a register of a port, read without counting the access */
+#define PORT_TEST_REG(PORT, OFFSET)   Port_Sim_PeekRegister(Port_Test_BaseAddress[(PORT)] + (OFFSET))
+
+/* Number of register writes of a port register */
+#define PORT_TEST_WRITES(PORT, OFFSET) Port_Sim_GetWriteCount(Port_Test_BaseAddress[(PORT)] + (OFFSET))
+
+/* GPIO Registers base address of each port, indexed by the port number */
+STATIC const uint32 Port_Test_BaseAddress[PORT_NUMBER_OF_PORTS] = {
+    GPIO_PORTA_BASE_ADDRESS,
+    GPIO_PORTB_BASE_ADDRESS,
+    GPIO_PORTC_BASE_ADDRESS,
+    GPIO_PORTD_BASE_ADDRESS,
+    GPIO_PORTE_BASE_ADDRESS,
+    GPIO_PORTF_BASE_ADDRESS};
+
+#if (PORT_SWITCH_CONFIGURATION_API == STD_ON)
+/* Shipped configuration with PF2 as a second output driven high and PB4 as an analog input */
+STATIC const Port_ConfigSinglePinType Port_Test_AlternatePins[] = {
+    PORT_PIN_CONFIG(B, 4, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, ADC_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(F, 1, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(F, 2, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, GPIO_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(F, 4, PORT_PIN_IN, PULL_UP, PORT_PIN_LEVEL_HIGH, GPIO_MODE, STD_OFF, STD_OFF)};
+
+STATIC const Port_ConfigType Port_Test_Alternate = {
+    Port_Test_AlternatePins,
+    (uint8)(sizeof(Port_Test_AlternatePins) / sizeof(Port_Test_AlternatePins[0])),
+    {
+        PORT_PORT_DEFAULT(A, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(B, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(C, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(D, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(E, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(F, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON)},
+    (1U << PORT_PortF)};
+#endif
+
+#if ((PORT_SWITCH_CONFIGURATION_API == STD_ON) && (PORT_INIT_IMAGE_API == STD_ON))
+/* Shipped configuration with PA0 as an output */
+STATIC const Port_ConfigSinglePinType Port_Test_OutputPA0Pins[] = {
+    PORT_PIN_CONFIG(A, 0, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(F, 1, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(F, 4, PORT_PIN_IN, PULL_UP, PORT_PIN_LEVEL_HIGH, GPIO_MODE, STD_OFF, STD_OFF)};
+
+STATIC const Port_ConfigType Port_Test_OutputPA0 = {
+    Port_Test_OutputPA0Pins,
+    (uint8)(sizeof(Port_Test_OutputPA0Pins) / sizeof(Port_Test_OutputPA0Pins[0])),
+    {
+        PORT_PORT_DEFAULT(A, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(B, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(C, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(D, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(E, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(F, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON)},
+    (1U << PORT_PortF)};
+#endif
+
+#if (PORT_INIT_IMAGE_API == STD_ON)
+/* Post-build configuration image built by the tests */
+STATIC uint32 Port_Test_Image[PORT_IMAGE_MAX_SIZE / sizeof(uint32)];
+#endif
+
+/* Configuration listing only PB2, the other pins of port B are inputs with pull-up */
+STATIC const Port_ConfigSinglePinType Port_Test_SparsePins[] = {
+    PORT_PIN_CONFIG(B, 2, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, GPIO_MODE, STD_ON, STD_ON)};
+
+STATIC const Port_ConfigType Port_Test_Sparse = {
+    Port_Test_SparsePins,
+    (uint8)(sizeof(Port_Test_SparsePins) / sizeof(Port_Test_SparsePins[0])),
+    {
+        PORT_PORT_DEFAULT(A, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(B, PORT_PIN_IN, PULL_UP, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(C, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(D, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(E, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(F, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON)},
+    (1U << PORT_PortB)};
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+/* Configuration listing PB2 twice */
+STATIC const Port_ConfigSinglePinType Port_Test_TwicePins[] = {
+    PORT_PIN_CONFIG(B, 2, PORT_PIN_OUT, OFF, PORT_PIN_LEVEL_HIGH, GPIO_MODE, STD_ON, STD_ON),
+    PORT_PIN_CONFIG(B, 2, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON)};
+
+STATIC const Port_ConfigType Port_Test_Twice = {
+    Port_Test_TwicePins,
+    (uint8)(sizeof(Port_Test_TwicePins) / sizeof(Port_Test_TwicePins[0])),
+    {
+        PORT_PORT_DEFAULT(A, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(B, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(C, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(D, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(E, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON),
+        PORT_PORT_DEFAULT(F, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, GPIO_MODE, STD_ON, STD_ON)},
+    (1U << PORT_PortB)};
+#endif
+
+/* Number of checks made and failed */
+STATIC uint32 Port_Test_Checks = 0;
+STATIC uint32 Port_Test_Failures = 0;
+
+/* Name of the running test, printed with its failed checks */
+STATIC const char *Port_Test_Name = "";
+
+/************************************************************************************
+ * Function Name: Port_Test_Check
+ * Parameters (in): Passed - Result of the check, Condition - Text of the check, Line - Line of the check
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Counts a check and prints it when it failed.
+ ************************************************************************************/
+STATIC void Port_Test_Check(boolean Passed, const char *Condition, int Line)
+{
+    Port_Test_Checks++;
+    if (Passed == FALSE)
+    {
+        Port_Test_Failures++;
+        printf("FAILED %s: Port_Test.c:%d: %s\n", Port_Test_Name, Line, Condition);
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_Test_TakeError
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Error ID of the oldest development error not taken yet, 0 when there is none
+ * Description: Drains one development error.
+ ************************************************************************************/
+STATIC uint8 Port_Test_TakeError(void)
+{
+    Det_ErrorType error;
+
+    return (Det_GetError(&error) == E_OK) ? error.errorId : 0U;
+}
+
+/************************************************************************************
+ * Function Name: Port_Test_Start
+ * Parameters (in): Name - Name of the test
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Puts the simulated register file in its reset state and drops the development
+ *              errors of the previous test.
+ ************************************************************************************/
+STATIC void Port_Test_Start(const char *Name)
+{
+    Port_Test_Name = Name;
+    Port_Sim_Reset();
+    while (Port_Test_TakeError() != 0U)
+    {
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_Test_InitLatePorts
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Initializes the ports Port_Init leaves to Port_InitPort.
+ ************************************************************************************/
+STATIC void Port_Test_InitLatePorts(void)
+{
+#if (PORT_INIT_PORT_API == STD_ON)
+    uint8 port;
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        Port_InitPort(port);
+    }
+#endif
+}
+
+/************************************************************************************
+ * Function Name: Port_Test_InitAll
+ * Parameters (in): ConfigPtr - Pointer to configuration set
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Initializes the driver and every port of the configuration set.
+ ************************************************************************************/
+STATIC void Port_Test_InitAll(const Port_ConfigType *ConfigPtr)
+{
+    Port_Init(ConfigPtr);
+    Port_Test_InitLatePorts();
+}
+
+/************************************************************************************
+ * Function Name: Port_Test_Init
+ * Description: Port_Init applies the shipped configuration with one write per register per port,
+ *              opens the locked pins it configures and leaves the JTAG pins alone.
+ ************************************************************************************/
+STATIC void Port_Test_Init(void)
+{
+    uint8 port;
+
+    Port_Test_Start("Port_Init");
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+    /* PF1 is an output driven low, PF4 an input with its pull up, the other pins digital inputs */
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0x02U);
+    PORT_TEST_CHECK((PORT_TEST_REG(PORT_PortF, PORT_DATA_REG_OFFSET) & 0x02U) == 0U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_PULL_UP_REG_OFFSET) == 0x10U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0x1FU);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortE, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0x3FU);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortA, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0xFFU);
+
+    /* PD7 and PF0 were unlocked, the JTAG pins PC0-PC3 keep their reset configuration */
+    PORT_TEST_CHECK((PORT_TEST_REG(PORT_PortD, PORT_COMMIT_REG_OFFSET) & 0x80U) != 0U);
+    PORT_TEST_CHECK((PORT_TEST_REG(PORT_PortF, PORT_COMMIT_REG_OFFSET) & 0x01U) != 0U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortC, PORT_ALT_FUNC_REG_OFFSET) == 0x0FU);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortC, PORT_CTL_REG_OFFSET) == 0x00001111U);
+
+    /* One masked write of each register of each port, the whole Port_Init within its budget */
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        PORT_TEST_CHECK(PORT_TEST_WRITES(port, PORT_DIR_REG_OFFSET) == 1U);
+        PORT_TEST_CHECK(PORT_TEST_WRITES(port, PORT_CTL_REG_OFFSET) == 1U);
+    }
+#if (PORT_INIT_PORT_API == STD_OFF)
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == PORT_BUDGET_INIT_READS);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == PORT_BUDGET_INIT_WRITES);
+#endif
+    PORT_TEST_CHECK(Port_Sim_GetFaultCount() == 0U);
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_Test_SetPortPinsDirection
+ * Description: Several pins of a port change direction with one read-modify-write, and a mask with
+ *              a pin whose direction is not changeable is rejected without any access.
+ ************************************************************************************/
+STATIC void Port_Test_SetPortPinsDirection(void)
+{
+    Port_Test_Start("Port_SetPortPinsDirection");
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+    Port_Sim_ClearCounters();
+    Port_SetPortPinsDirection(PORT_PortA, 0x0FU, 0x05U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortA, PORT_DIR_REG_OFFSET) == 0x05U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() <= 1U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 1U);
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* PF4 is not direction changeable in the shipped configuration */
+    Port_Sim_ClearCounters();
+    Port_SetPortPinsDirection(PORT_PortF, 0x18U, 0x18U);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_DIRECTION_UNCHANGEABLE);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0x02U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+#endif
+}
+#endif
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_Test_SetPortPinsMode
+ * Description: Several pins of a port change mode with one read-modify-write of each mode register,
+ *              and a mode one of the pins does not support is rejected without any access.
+ ************************************************************************************/
+STATIC void Port_Test_SetPortPinsMode(void)
+{
+    Port_Test_Start("Port_SetPortPinsMode");
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+    /* PB4 and PB5 become analog inputs, routed through their alternate function select */
+    Port_Sim_ClearCounters();
+    Port_SetPortPinsMode(PORT_PortB, 0x30U, ADC_MODE);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_ANALOG_MODE_SEL_REG_OFFSET) == 0x30U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0xCFU);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_ALT_FUNC_REG_OFFSET) == 0x30U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_CTL_REG_OFFSET) == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() <= 4U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 4U);
+
+    /* PB0 and PB1 both support UART1 */
+    Port_SetPortPinsMode(PORT_PortB, 0x03U, PB0_U1Rx);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_ALT_FUNC_REG_OFFSET) == 0x33U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_CTL_REG_OFFSET) == 0x00000011U);
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* PB2 has no analog signal */
+    Port_Sim_ClearCounters();
+    Port_SetPortPinsMode(PORT_PortB, 0x14U, ADC_MODE);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_PARAM_INVALID_MODE);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_ANALOG_MODE_SEL_REG_OFFSET) == 0x30U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+#endif
+}
+#endif
+
+#if (PORT_REFRESH_DRIFT_DETECTION == STD_ON)
+/************************************************************************************
+ * Function Name: Port_Test_RefreshDrift
+ * Description: Port_RefreshPortDirection only reads the ports with fixed direction pins, rewrites a
+ *              direction register only when it drifted and counts the drifted port and pins.
+ ************************************************************************************/
+STATIC void Port_Test_RefreshDrift(void)
+{
+    Port_DriftCountersType counters;
+
+    Port_Test_Start("Port_RefreshPortDirection drift");
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+    /* Only PF4 has a fixed direction, and it has not drifted */
+    Port_Sim_ClearCounters();
+    Port_RefreshPortDirection();
+    Port_GetDriftCounters(&counters);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 1U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+    PORT_TEST_CHECK(counters.portCorrections[PORT_PortF] == 0U);
+
+    /* PF4 turned into an output behind the driver's back */
+    Port_Sim_WriteRegister(Port_Test_BaseAddress[PORT_PortF] + PORT_DIR_REG_OFFSET, 0x12U);
+    Port_Sim_ClearCounters();
+    Port_RefreshPortDirection();
+    Port_GetDriftCounters(&counters);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0x02U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 1U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 1U);
+    PORT_TEST_CHECK(counters.portCorrections[PORT_PortF] == 1U);
+    PORT_TEST_CHECK(counters.pinCorrections[PF4] == 1U);
+    PORT_TEST_CHECK(counters.pinCorrections[PF1] == 0U);
+
+    /* A new Port_Init starts counting again */
+    Port_Test_InitAll(&Port_PinConfigArray);
+    Port_GetDriftCounters(&counters);
+    PORT_TEST_CHECK(counters.portCorrections[PORT_PortF] == 0U);
+    PORT_TEST_CHECK(counters.pinCorrections[PF4] == 0U);
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_Test_ClockGating
+ * Description: Port_Init opens the clock of all its ports with a single write of RCGCGPIO
+ *              and polls PRGPIO until they are ready.
+ ************************************************************************************/
+STATIC void Port_Test_ClockGating(void)
+{
+    Port_Test_Start("Port_Init clock gating");
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+#if (PORT_INIT_PORT_API == STD_OFF)
+    PORT_TEST_CHECK(Port_Sim_GetWriteCount(SYSCTL_RCGCGPIO_REG_ADDRESS) == 1U);
+#endif
+    PORT_TEST_CHECK(Port_Sim_GetWriteCount(SYSCTL_RCGC2_REG_ADDRESS) == 0U);
+    PORT_TEST_CHECK((Port_Sim_PeekRegister(SYSCTL_RCGCGPIO_REG_ADDRESS) & 0x3FU) == 0x3FU);
+    PORT_TEST_CHECK(Port_Sim_GetReadCount(SYSCTL_PRGPIO_REG_ADDRESS) >= 1U);
+}
+
+#if (PORT_INIT_PORT_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_Test_InitPort
+ * Description: Port_Init only initializes the early ports, Port_InitPort initializes one of
+ *              the other ports once and ignores the ports already initialized.
+ ************************************************************************************/
+STATIC void Port_Test_InitPort(void)
+{
+    uint32 writes;
+
+    Port_Test_Start("Port_InitPort");
+    Port_Init(&Port_PinConfigArray);
+
+    /* Only port F is early in the shipped configuration */
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0x1FU);
+    PORT_TEST_CHECK(PORT_TEST_WRITES(PORT_PortA, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0U);
+    PORT_TEST_CHECK((Port_Sim_PeekRegister(SYSCTL_RCGCGPIO_REG_ADDRESS) & 0x3FU) == 0x20U);
+
+    Port_Sim_ClearCounters();
+    Port_InitPort(PORT_PortA);
+    writes = Port_Sim_GetTotalWriteCount();
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortA, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0xFFU);
+    PORT_TEST_CHECK((Port_Sim_PeekRegister(SYSCTL_RCGCGPIO_REG_ADDRESS) & 0x3FU) == 0x21U);
+    PORT_TEST_CHECK(Port_Sim_GetFaultCount() == 0U);
+
+    /* A second call leaves the port alone */
+    Port_InitPort(PORT_PortA);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == writes);
+
+    Port_InitPort(PORT_NUMBER_OF_PORTS);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_PARAM_PIN);
+}
+#endif
+
+#if (PORT_SWITCH_CONFIGURATION_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_Test_SwitchConfiguration
+ * Description: Port_SwitchConfiguration writes only the registers that differ between the two sets,
+ *              reuses a delta for the same pair of sets and computes it again after a Port_Init.
+ *              Like Port_Init it drops an open update and clears the drift counters.
+ ************************************************************************************/
+STATIC void Port_Test_SwitchConfiguration(void)
+{
+    Port_ConfigDeltaType toAlternate;
+    Port_ConfigDeltaType toShipped;
+#if (PORT_REFRESH_DRIFT_DETECTION == STD_ON)
+    Port_DriftCountersType counters;
+#endif
+
+    Port_Test_Start("Port_SwitchConfiguration");
+    memset(&toAlternate, 0, sizeof(toAlternate));
+    memset(&toShipped, 0, sizeof(toShipped));
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+    Port_Sim_ClearCounters();
+    Port_SwitchConfiguration(&Port_Test_Alternate, &toAlternate);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0x06U);
+    PORT_TEST_CHECK((PORT_TEST_REG(PORT_PortF, PORT_DATA_REG_OFFSET) & 0x04U) == 0x04U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_ANALOG_MODE_SEL_REG_OFFSET) == 0x10U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0xEFU);
+
+    /* Ports the two sets configure the same way are not accessed */
+    PORT_TEST_CHECK(PORT_TEST_WRITES(PORT_PortA, PORT_DIR_REG_OFFSET) == 0U);
+    PORT_TEST_CHECK(PORT_TEST_WRITES(PORT_PortA, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0U);
+    PORT_TEST_CHECK(PORT_TEST_WRITES(PORT_PortF, PORT_CTL_REG_OFFSET) == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetFaultCount() == 0U);
+
+    /* The round trip back restores the shipped registers */
+    Port_SwitchConfiguration(&Port_PinConfigArray, &toShipped);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0x02U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_ANALOG_MODE_SEL_REG_OFFSET) == 0U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0xFFU);
+
+#if ((PORT_UPDATE_TRANSACTION_API == STD_ON) && (PORT_SET_PIN_DIRECTION_API == STD_ON))
+    /* A switch drops the changes staged against the previous set */
+    Port_Test_Start("Port_SwitchConfiguration during an update");
+    Port_Test_InitAll(&Port_PinConfigArray);
+    Port_BeginUpdate();
+    Port_SetPinDirection(PF1, PORT_PIN_IN);
+    Port_SwitchConfiguration(&Port_Test_Alternate, &toAlternate);
+    Port_Sim_ClearCounters();
+    Port_CommitUpdate();
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0x06U);
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_UPDATE_SEQUENCE);
+#endif
+#endif
+
+#if (PORT_REFRESH_DRIFT_DETECTION == STD_ON)
+    /* A switch starts counting the drift again */
+    Port_Test_Start("Port_SwitchConfiguration drift counters");
+    Port_Test_InitAll(&Port_PinConfigArray);
+    Port_Sim_WriteRegister(Port_Test_BaseAddress[PORT_PortF] + PORT_DIR_REG_OFFSET, 0x12U);
+    Port_RefreshPortDirection();
+    Port_GetDriftCounters(&counters);
+    PORT_TEST_CHECK(counters.pinCorrections[PF4] == 1U);
+    Port_SwitchConfiguration(&Port_Test_Alternate, &toAlternate);
+    Port_GetDriftCounters(&counters);
+    PORT_TEST_CHECK(counters.portCorrections[PORT_PortF] == 0U);
+    PORT_TEST_CHECK(counters.pinCorrections[PF4] == 0U);
+#endif
+
+#if (PORT_INIT_IMAGE_API == STD_ON)
+    /* Every image is initialized through the same configuration set, so the delta computed after the
+     * first image must not be reused after the second one drives PA0 as an output */
+    PORT_TEST_CHECK(Port_ImageTool_Build(&Port_PinConfigArray, Port_Test_Image, sizeof(Port_Test_Image)) != 0U);
+    PORT_TEST_CHECK(Port_InitImage((const Port_ImageHeaderType *)Port_Test_Image) == E_OK);
+    Port_Test_InitLatePorts();
+    Port_SwitchConfiguration(&Port_Test_Alternate, &toAlternate);
+    PORT_TEST_CHECK(Port_ImageTool_Build(&Port_Test_OutputPA0, Port_Test_Image, sizeof(Port_Test_Image)) != 0U);
+    PORT_TEST_CHECK(Port_InitImage((const Port_ImageHeaderType *)Port_Test_Image) == E_OK);
+    Port_Test_InitLatePorts();
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortA, PORT_DIR_REG_OFFSET) == 0x01U);
+    Port_SwitchConfiguration(&Port_Test_Alternate, &toAlternate);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortA, PORT_DIR_REG_OFFSET) == 0U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0x06U);
+#endif
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_Test_Dio
+ * Description: The Dio services access one pin or one group of pins through its data register
+ *              alias, without read-modify-write of the whole port.
+ ************************************************************************************/
+STATIC void Port_Test_Dio(void)
+{
+    const Dio_ChannelGroupType group = {0x06U, 1U, PORT_PortF};
+
+    Port_Test_Start("Dio masked data accesses");
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+    /* A channel write is a single store that leaves the other pins alone */
+    Port_Sim_SetPinInputs(PORT_PortF, 0x10U);
+    Port_Sim_ClearCounters();
+    Dio_WriteChannel(PF1, STD_HIGH);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DATA_REG_OFFSET) == 0x12U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 1U);
+
+    /* A channel read is a single load of the pin level */
+    Port_Sim_ClearCounters();
+    PORT_TEST_CHECK(Dio_ReadChannel(PF1) == STD_HIGH);
+    Port_Sim_SetPinInputs(PORT_PortF, 0x00U);
+    PORT_TEST_CHECK(Dio_ReadChannel(PF4) == STD_LOW);
+    Port_Sim_SetPinInputs(PORT_PortF, 0x10U);
+    PORT_TEST_CHECK(Dio_ReadChannel(PF4) == STD_HIGH);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 3U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+
+#if (DIO_FLIP_CHANNEL_API == STD_ON)
+    /* A flip is one load and one store of the pin alias */
+    Port_Sim_ClearCounters();
+    PORT_TEST_CHECK(Dio_FlipChannel(PF1) == STD_LOW);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DATA_REG_OFFSET) == 0x10U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 1U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 1U);
+#endif
+
+    /* A group write is a single store of the group bits, PF2 is made an output for it */
+    Port_Sim_WriteRegister(Port_Test_BaseAddress[PORT_PortF] + PORT_DIR_REG_OFFSET, 0x06U);
+    Port_Sim_ClearCounters();
+    Dio_WriteChannelGroup(&group, 0x03U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DATA_REG_OFFSET) == 0x16U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 1U);
+
+#if (DIO_DEV_ERROR_DETECT == STD_ON)
+    /* Invalid channels and groups are reported without any access */
+    Port_Sim_ClearCounters();
+    Dio_WriteChannel(DIO_NUMBER_OF_CHANNELS, STD_HIGH);
+    PORT_TEST_CHECK(Port_Test_TakeError() == DIO_E_PARAM_INVALID_CHANNEL_ID);
+    Dio_WriteChannelGroup(NULL_PTR, 0x01U);
+    PORT_TEST_CHECK(Port_Test_TakeError() == DIO_E_PARAM_POINTER);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+#endif
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_Test_PinModes
+ * Description: Port_SetPinMode only accepts the modes allowed on the pin itself, and the analog
+ *              mode no longer shares its value with the first alternate function. The pins with
+ *              an analog signal in the datasheet accept the analog mode.
+ ************************************************************************************/
+STATIC void Port_Test_PinModes(void)
+{
+    Port_Test_Start("Port_SetPinMode allowed modes");
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    /* PA0 has no analog function, mode 11 is no function at all and 16 does not fit the bitmaps */
+    Port_Sim_ClearCounters();
+    Port_SetPinMode(PA0, ADC_MODE);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_PARAM_INVALID_MODE);
+    Port_SetPinMode(PB4, 11U);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_PARAM_INVALID_MODE);
+    Port_SetPinMode(PF1, PORT_NUMBER_OF_PIN_MODES);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_PARAM_INVALID_MODE);
+
+    /* PF4 is configured with an unchangeable mode */
+    Port_SetPinMode(PF4, PF4_T2CCP0);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_MODE_UNCHANGEABLE);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+#endif
+
+    /* U0Rx has the PMCx value the analog mode used to have, PA0 stays digital */
+    Port_SetPinMode(PA0, PA0_U0Rx);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortA, PORT_ALT_FUNC_REG_OFFSET) == 0x01U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortA, PORT_CTL_REG_OFFSET) == 0x00000001U);
+    PORT_TEST_CHECK((PORT_TEST_REG(PORT_PortA, PORT_DIGITAL_ENABLE_REG_OFFSET) & 0x01U) == 0x01U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortA, PORT_ANALOG_MODE_SEL_REG_OFFSET) == 0U);
+
+    /* PB4 becomes an analog input with no digital function selected */
+    Port_SetPinMode(PB4, PB4_T1CCP0);
+    Port_SetPinMode(PB4, ADC_MODE);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_ANALOG_MODE_SEL_REG_OFFSET) == 0x10U);
+    PORT_TEST_CHECK((PORT_TEST_REG(PORT_PortB, PORT_DIGITAL_ENABLE_REG_OFFSET) & 0x10U) == 0U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_ALT_FUNC_REG_OFFSET) == 0x10U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_CTL_REG_OFFSET) == 0U);
+
+    /* And back to a digital input */
+    Port_SetPinMode(PB4, GPIO_MODE);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_ANALOG_MODE_SEL_REG_OFFSET) == 0U);
+    PORT_TEST_CHECK((PORT_TEST_REG(PORT_PortB, PORT_DIGITAL_ENABLE_REG_OFFSET) & 0x10U) == 0x10U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_ALT_FUNC_REG_OFFSET) == 0U);
+
+    /* The USB analog signals of PB0/PB1 and PD4/PD5 are selected like the ADC inputs */
+    Port_SetPinMode(PB0, ADC_MODE);
+    Port_SetPinMode(PD4, ADC_MODE);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_ANALOG_MODE_SEL_REG_OFFSET) == 0x01U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortD, PORT_ANALOG_MODE_SEL_REG_OFFSET) == 0x10U);
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_Test_Det
+ * Description: Det folds identical consecutive reports into one entry, drains the entries in
+ *              report order and counts the reports dropped while its buffer is full.
+ ************************************************************************************/
+STATIC void Port_Test_Det(void)
+{
+    Det_ErrorType error;
+    uint16 lost;
+    uint8 api;
+
+    Port_Test_Start("Det error buffer");
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+#if ((PORT_DEV_ERROR_DETECT == STD_ON) && (PORT_SET_PIN_DIRECTION_API == STD_ON))
+    /* Three rejected direction changes of PF4 are one entry counted three times */
+    Port_Sim_ClearCounters();
+    Port_SetPinDirection(PF4, PORT_PIN_OUT);
+    Port_SetPinDirection(PF4, PORT_PIN_OUT);
+    Port_SetPinDirection(PF4, PORT_PIN_OUT);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+    PORT_TEST_CHECK(Det_GetError(&error) == E_OK);
+    PORT_TEST_CHECK(error.moduleId == PORT_MODULE_ID);
+    PORT_TEST_CHECK(error.apiId == PORT_SET_PIN_DIRECTION_SID);
+    PORT_TEST_CHECK(error.errorId == PORT_E_DIRECTION_UNCHANGEABLE);
+    PORT_TEST_CHECK(error.count == 3U);
+#endif
+    PORT_TEST_CHECK(Det_GetError(&error) == E_NOT_OK);
+    PORT_TEST_CHECK(Det_GetError(NULL_PTR) == E_NOT_OK);
+
+    /* Only a repeat of the newest entry is folded */
+    (void)Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
+    (void)Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_UNINIT);
+    (void)Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
+    PORT_TEST_CHECK((Det_GetError(&error) == E_OK) && (error.errorId == PORT_E_PARAM_PIN) && (error.count == 1U));
+    PORT_TEST_CHECK((Det_GetError(&error) == E_OK) && (error.errorId == PORT_E_UNINIT) && (error.count == 1U));
+    PORT_TEST_CHECK((Det_GetError(&error) == E_OK) && (error.errorId == PORT_E_PARAM_PIN) && (error.count == 1U));
+    PORT_TEST_CHECK(Det_GetError(&error) == E_NOT_OK);
+
+    /* The reports made while the buffer is full are lost, the recorded ones are drained in order */
+    lost = Det_GetLostCount();
+    for (api = 0U; api < (DET_BUFFER_SIZE + 4U); api++)
+    {
+        (void)Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, api, PORT_E_PARAM_PIN);
+    }
+    PORT_TEST_CHECK(Det_GetLostCount() == (uint16)(lost + 4U));
+    for (api = 0U; api < DET_BUFFER_SIZE; api++)
+    {
+        PORT_TEST_CHECK((Det_GetError(&error) == E_OK) && (error.apiId == api));
+    }
+    PORT_TEST_CHECK(Det_GetError(&error) == E_NOT_OK);
+
+    /* A drained buffer records again */
+    (void)Det_ReportError(PORT_MODULE_ID, PORT_INSTANCE_ID, PORT_SET_PIN_MODE_SID, PORT_E_PARAM_PIN);
+    PORT_TEST_CHECK(Det_GetLostCount() == (uint16)(lost + 4U));
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_PARAM_PIN);
+}
+
+#if (PORT_INIT_IMAGE_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_Test_SealImage
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Computes the CRC of the test image again after one of its fields was changed.
+ ************************************************************************************/
+STATIC void Port_Test_SealImage(void)
+{
+    Port_ImageHeaderType *header = (Port_ImageHeaderType *)Port_Test_Image;
+
+    header->crc = Port_ImageCrc32((const uint8 *)Port_Test_Image + PORT_IMAGE_CRC_OFFSET,
+                                  (sizeof(Port_ImageHeaderType) - PORT_IMAGE_CRC_OFFSET) + header->length);
+}
+
+/************************************************************************************
+ * Function Name: Port_Test_IsImageRejected
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: boolean - TRUE if Port_InitImage refused the test image without any register write
+ * Description: Passes the test image to Port_InitImage and checks it was refused.
+ ************************************************************************************/
+STATIC boolean Port_Test_IsImageRejected(void)
+{
+    Std_ReturnType result;
+
+    Port_Sim_ClearCounters();
+    result = Port_InitImage((const Port_ImageHeaderType *)Port_Test_Image);
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    if (Port_Test_TakeError() != PORT_E_INIT_FAILED)
+    {
+        return FALSE;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+#endif
+    return ((result == E_NOT_OK) && (Port_Sim_GetTotalWriteCount() == 0U)) ? TRUE : FALSE;
+}
+
+/************************************************************************************
+ * Function Name: Port_Test_InitImage
+ * Description: Port_InitImage initializes the ports like Port_Init from a valid image, and refuses
+ *              an image with a wrong CRC, header, port default or pin before any register write.
+ ************************************************************************************/
+STATIC void Port_Test_InitImage(void)
+{
+    Port_ImageHeaderType *header = (Port_ImageHeaderType *)Port_Test_Image;
+    Port_ConfigSinglePinType *table = (Port_ConfigSinglePinType *)(header + 1);
+    uint16 size;
+
+    Port_Test_Start("Port_InitImage");
+
+    /* Check value of the CRC-32 used by the images */
+    PORT_TEST_CHECK(Port_ImageCrc32((const uint8 *)"123456789", 9U) == 0xCBF43926U);
+
+    /* The image of the shipped configuration sets the same registers as the configuration */
+    size = Port_ImageTool_Build(&Port_PinConfigArray, Port_Test_Image, sizeof(Port_Test_Image));
+    PORT_TEST_CHECK(size == (sizeof(Port_ImageHeaderType) + header->length));
+    PORT_TEST_CHECK(Port_InitImage((const Port_ImageHeaderType *)Port_Test_Image) == E_OK);
+    Port_Test_InitLatePorts();
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0x02U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_PULL_UP_REG_OFFSET) == 0x10U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0x1FU);
+
+    /* One bit of the pin table is flipped */
+    Port_Test_Start("Port_InitImage corrupted pin table");
+    table[PORT_NUMBER_OF_PORTS] ^= 0x0100U;
+    PORT_TEST_CHECK(Port_Test_IsImageRejected() == TRUE);
+
+    /* The image is not an image of this driver */
+    Port_Test_Start("Port_InitImage wrong header");
+    (void)Port_ImageTool_Build(&Port_PinConfigArray, Port_Test_Image, sizeof(Port_Test_Image));
+    header->magic ^= 1U;
+    PORT_TEST_CHECK(Port_Test_IsImageRejected() == TRUE);
+    (void)Port_ImageTool_Build(&Port_PinConfigArray, Port_Test_Image, sizeof(Port_Test_Image));
+    header->swMajorVersion++;
+    Port_Test_SealImage();
+    PORT_TEST_CHECK(Port_Test_IsImageRejected() == TRUE);
+    (void)Port_ImageTool_Build(&Port_PinConfigArray, Port_Test_Image, sizeof(Port_Test_Image));
+    header->length = (uint16)(header->length + sizeof(Port_ConfigSinglePinType));
+    Port_Test_SealImage();
+    PORT_TEST_CHECK(Port_Test_IsImageRejected() == TRUE);
+
+    /* A port default mode not allowed on every pin of the port, under a valid CRC */
+    Port_Test_Start("Port_InitImage invalid port default");
+    (void)Port_ImageTool_Build(&Port_PinConfigArray, Port_Test_Image, sizeof(Port_Test_Image));
+    table[PORT_PortA] = (Port_ConfigSinglePinType)((table[PORT_PortA] & ~(PORT_CONFIG_MODE_MASK << PORT_CONFIG_MODE_SHIFT)) |
+                                                   ((uint32)ADC_MODE << PORT_CONFIG_MODE_SHIFT));
+    Port_Test_SealImage();
+    PORT_TEST_CHECK(Port_Test_IsImageRejected() == TRUE);
+
+    /* A pin of a port the device does not have, under a valid CRC */
+    Port_Test_Start("Port_InitImage invalid pin");
+    (void)Port_ImageTool_Build(&Port_PinConfigArray, Port_Test_Image, sizeof(Port_Test_Image));
+    table[PORT_NUMBER_OF_PORTS] |= (Port_ConfigSinglePinType)(PORT_CONFIG_PORT_MASK << PORT_CONFIG_PORT_SHIFT);
+    Port_Test_SealImage();
+    PORT_TEST_CHECK(Port_Test_IsImageRejected() == TRUE);
+
+    /* The same pin listed twice, under a valid CRC */
+    Port_Test_Start("Port_InitImage duplicated pin");
+    (void)Port_ImageTool_Build(&Port_PinConfigArray, Port_Test_Image, sizeof(Port_Test_Image));
+    table[PORT_NUMBER_OF_PORTS + 1U] = table[PORT_NUMBER_OF_PORTS];
+    Port_Test_SealImage();
+    PORT_TEST_CHECK(Port_Test_IsImageRejected() == TRUE);
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    PORT_TEST_CHECK(Port_InitImage(NULL_PTR) == E_NOT_OK);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_PARAM_POINTER);
+#endif
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+#endif
+
+#if ((PORT_UPDATE_TRANSACTION_API == STD_ON) && (PORT_SET_PIN_DIRECTION_API == STD_ON) && (PORT_SET_PIN_MODE_API == STD_ON))
+/************************************************************************************
+ * Function Name: Port_Test_Update
+ * Description: The changes made between Port_BeginUpdate and Port_CommitUpdate are only staged,
+ *              the commit releases the pins first, switches the analog and PMCx selections and
+ *              engages the new functions and outputs last. Port_Init drops a pending update.
+ ************************************************************************************/
+STATIC void Port_Test_Update(void)
+{
+    const uint32 portB = Port_Test_BaseAddress[PORT_PortB];
+
+    Port_Test_Start("Port_CommitUpdate order");
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+    /* PB4 becomes analog, PB0 a UART input, PB1 and PF1 change direction */
+    Port_Sim_ClearCounters();
+    Port_BeginUpdate();
+    Port_SetPinMode(PB4, ADC_MODE);
+    Port_SetPinMode(PB0, PB0_U1Rx);
+    Port_SetPinDirection(PB1, PORT_PIN_OUT);
+    Port_SetPinDirection(PF1, PORT_PIN_IN);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+    Port_CommitUpdate();
+
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0xEFU);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_ANALOG_MODE_SEL_REG_OFFSET) == 0x10U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_CTL_REG_OFFSET) == 0x00000001U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_ALT_FUNC_REG_OFFSET) == 0x11U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_DIR_REG_OFFSET) == 0x02U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0U);
+
+    /* PB4 leaves the digital side before its analog switch, the new function and output come last */
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 6U);
+    PORT_TEST_CHECK(Port_Sim_GetLoggedWrite(0U) == (portB + PORT_DIGITAL_ENABLE_REG_OFFSET));
+    PORT_TEST_CHECK(Port_Sim_GetLoggedWrite(1U) == (portB + PORT_ANALOG_MODE_SEL_REG_OFFSET));
+    PORT_TEST_CHECK(Port_Sim_GetLoggedWrite(2U) == (portB + PORT_CTL_REG_OFFSET));
+    PORT_TEST_CHECK(Port_Sim_GetLoggedWrite(3U) == (portB + PORT_ALT_FUNC_REG_OFFSET));
+    PORT_TEST_CHECK(Port_Sim_GetLoggedWrite(4U) == (portB + PORT_DIR_REG_OFFSET));
+    PORT_TEST_CHECK(Port_Sim_GetLoggedWrite(5U) == (Port_Test_BaseAddress[PORT_PortF] + PORT_DIR_REG_OFFSET));
+#if (PORT_SHADOW_REGISTERS == STD_ON)
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 0U);
+#else
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() <= 6U);
+#endif
+
+    /* A new Port_Init drops the staged changes */
+    Port_Test_Start("Port_CommitUpdate after Port_Init");
+    Port_Test_InitAll(&Port_PinConfigArray);
+    Port_BeginUpdate();
+    Port_SetPinDirection(PF1, PORT_PIN_IN);
+    Port_Test_InitAll(&Port_PinConfigArray);
+    Port_Sim_ClearCounters();
+    Port_CommitUpdate();
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0x02U);
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_UPDATE_SEQUENCE);
+
+    /* An update cannot be started twice */
+    Port_BeginUpdate();
+    Port_BeginUpdate();
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_UPDATE_SEQUENCE);
+    Port_CommitUpdate();
+#endif
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+#endif
+
+#if ((PORT_SHADOW_REGISTERS == STD_ON) && (PORT_SET_PIN_DIRECTION_API == STD_ON) && (PORT_SET_PIN_MODE_API == STD_ON))
+/************************************************************************************
+ * Function Name: Port_Test_ShadowRegisters
+ * Description: With the register shadows the single pin services write their registers without
+ *              reading them, and Port_ResyncShadowRegisters picks up the changes made behind the
+ *              driver's back.
+ ************************************************************************************/
+STATIC void Port_Test_ShadowRegisters(void)
+{
+    Port_Test_Start("Port shadow registers");
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+    /* A direction change is one write */
+    Port_Sim_ClearCounters();
+    Port_SetPinDirection(PF1, PORT_PIN_IN);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 1U);
+
+    /* A mode change writes at most its four mode registers */
+    Port_Sim_ClearCounters();
+    Port_SetPinMode(PB4, ADC_MODE);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_ANALOG_MODE_SEL_REG_OFFSET) == 0x10U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0xEFU);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() <= 4U);
+
+    /* PF2 is made an output behind the driver's back, the resync keeps it */
+    Port_Sim_WriteRegister(Port_Test_BaseAddress[PORT_PortF] + PORT_DIR_REG_OFFSET, 0x04U);
+    Port_Sim_ClearCounters();
+    Port_ResyncShadowRegisters();
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() != 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+    Port_Sim_ClearCounters();
+    Port_SetPinDirection(PF1, PORT_PIN_OUT);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0x06U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 1U);
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+#endif
+
+#if (PORT_VERIFY_CONFIGURATION_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_Test_VerifyConfiguration
+ * Description: Port_VerifyConfiguration reads the seven configuration registers of each port once
+ *              and flags the registers of the fixed pins that no longer hold their configuration.
+ ************************************************************************************/
+STATIC void Port_Test_VerifyConfiguration(void)
+{
+    const uint32 portF = Port_Test_BaseAddress[PORT_PortF];
+
+    Port_Test_Start("Port_VerifyConfiguration");
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+    /* Right after Port_Init every register matches */
+    Port_Sim_ClearCounters();
+    PORT_TEST_CHECK(Port_VerifyConfiguration() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == (PORT_NUMBER_OF_PORTS * PORT_VERIFY_REGISTERS_PER_PORT));
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+    /* The direction of PF1 is changeable and not checked */
+    Port_SetPinDirection(PF1, PORT_PIN_IN);
+    PORT_TEST_CHECK(Port_VerifyConfiguration() == 0U);
+#endif
+
+    /* PF4 is fixed: it turned into an output and lost its pull-up */
+    Port_Sim_WriteRegister(portF + PORT_DIR_REG_OFFSET, Port_Sim_PeekRegister(portF + PORT_DIR_REG_OFFSET) | 0x10U);
+    Port_Sim_WriteRegister(portF + PORT_PULL_UP_REG_OFFSET, 0U);
+    PORT_TEST_CHECK(Port_VerifyConfiguration() == (PORT_VERIFY_MISMATCH_BIT(PORT_PortF, PORT_VERIFY_DIR) |
+                                                   PORT_VERIFY_MISMATCH_BIT(PORT_PortF, PORT_VERIFY_PUR)));
+
+    /* And it was routed to a timer */
+    Port_Test_InitAll(&Port_PinConfigArray);
+    Port_Sim_WriteRegister(portF + PORT_ALT_FUNC_REG_OFFSET, 0x10U);
+    Port_Sim_WriteRegister(portF + PORT_CTL_REG_OFFSET, (uint32)PF4_T2CCP0 << 16);
+    PORT_TEST_CHECK(Port_VerifyConfiguration() == (PORT_VERIFY_MISMATCH_BIT(PORT_PortF, PORT_VERIFY_AFSEL) |
+                                                   PORT_VERIFY_MISMATCH_BIT(PORT_PortF, PORT_VERIFY_PCTL)));
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+#endif
+
+#if (PORT_SNAPSHOT_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_Test_Snapshot
+ * Description: Port_Snapshot reads the nine registers of each clocked port and nothing of the gated
+ *              ones, Port_DiffSnapshots reports exactly the bits and ports that changed.
+ ************************************************************************************/
+STATIC void Port_Test_Snapshot(void)
+{
+    Port_SnapshotType reset;
+    Port_SnapshotType initialized;
+    Port_SnapshotType changed;
+    Port_SnapshotType changes;
+
+    Port_Test_Start("Port_Snapshot and Port_DiffSnapshots");
+
+    /* Before Port_Init every port is gated, only the clock status registers are read */
+    Port_Sim_ClearCounters();
+    Port_Snapshot(&reset);
+    PORT_TEST_CHECK(reset.portMask == 0U);
+    PORT_TEST_CHECK(reset.ports[PORT_PortF].dir == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 2U);
+    PORT_TEST_CHECK(Port_Sim_GetFaultCount() == 0U);
+
+    Port_Test_InitAll(&Port_PinConfigArray);
+    Port_Sim_ClearCounters();
+    Port_Snapshot(&initialized);
+    PORT_TEST_CHECK(initialized.portMask == 0x3FU);
+    PORT_TEST_CHECK(initialized.ports[PORT_PortF].dir == 0x02U);
+    PORT_TEST_CHECK(initialized.ports[PORT_PortF].pur == 0x10U);
+    PORT_TEST_CHECK(initialized.ports[PORT_PortF].den == 0x1FU);
+    PORT_TEST_CHECK(initialized.ports[PORT_PortC].pctl == 0x00001111U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == (2U + (PORT_NUMBER_OF_PORTS * 9U)));
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetFaultCount() == 0U);
+
+    /* Every port was clocked by Port_Init */
+    PORT_TEST_CHECK(Port_DiffSnapshots(&reset, &initialized, &changes) == 0x3FU);
+    PORT_TEST_CHECK(changes.ports[PORT_PortF].dir == 0x02U);
+    PORT_TEST_CHECK(changes.ports[PORT_PortF].pur == 0x10U);
+    PORT_TEST_CHECK(changes.portMask == 0x3FU);
+
+    /* Identical snapshots have no change */
+    PORT_TEST_CHECK(Port_DiffSnapshots(&initialized, &initialized, &changes) == 0U);
+    PORT_TEST_CHECK(changes.ports[PORT_PortF].dir == 0U);
+
+    /* PF2 becomes an output, only its direction bit changes */
+    Port_Sim_WriteRegister(Port_Test_BaseAddress[PORT_PortF] + PORT_DIR_REG_OFFSET, 0x06U);
+    Port_Snapshot(&changed);
+    PORT_TEST_CHECK(Port_DiffSnapshots(&initialized, &changed, &changes) == (1U << PORT_PortF));
+    PORT_TEST_CHECK(changes.ports[PORT_PortF].dir == 0x04U);
+    PORT_TEST_CHECK(changes.ports[PORT_PortF].den == 0U);
+    PORT_TEST_CHECK(changes.ports[PORT_PortF].pctl == 0U);
+    PORT_TEST_CHECK(changes.ports[PORT_PortE].dir == 0U);
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    Port_Snapshot(NULL_PTR);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_PARAM_POINTER);
+    PORT_TEST_CHECK(Port_DiffSnapshots(&initialized, NULL_PTR, &changes) == 0U);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_PARAM_POINTER);
+#endif
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+#endif
+
+#if ((PORT_BIT_BAND_ACCESS == STD_ON) && (PORT_SHADOW_REGISTERS == STD_OFF) && (PORT_SET_PIN_DIRECTION_API == STD_ON))
+/************************************************************************************
+ * Function Name: Port_Test_BitBand
+ * Description: With bit-band access a single pin change is one store to the alias word of its bit,
+ *              without reading the register.
+ ************************************************************************************/
+STATIC void Port_Test_BitBand(void)
+{
+    Port_Test_Start("Port bit-band access");
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+    /* PF1 becomes an input, PF4 is left alone */
+    Port_Sim_WriteRegister(Port_Test_BaseAddress[PORT_PortF] + PORT_DIR_REG_OFFSET, 0x12U);
+    Port_Sim_ClearCounters();
+    Port_SetPinDirection(PF1, PORT_PIN_IN);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0x10U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 1U);
+    PORT_TEST_CHECK(Port_Sim_GetLoggedWrite(0U) == (Port_Test_BaseAddress[PORT_PortF] + PORT_DIR_REG_OFFSET));
+    PORT_TEST_CHECK(Port_Sim_GetFaultCount() == 0U);
+
+    Port_SetPinDirection(PF1, PORT_PIN_OUT);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0x12U);
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_Test_Aperture
+ * Description: Port_Init moves its ports to the AHB aperture when it is selected, every later
+ *              access goes through the aperture of its port and costs the cycles of that bus.
+ ************************************************************************************/
+STATIC void Port_Test_Aperture(void)
+{
+    Port_Test_Start("Port GPIO aperture");
+    Port_Test_InitAll(&Port_PinConfigArray);
+    PORT_TEST_CHECK(Port_Sim_GetFaultCount() == 0U);
+#if (PORT_AHB_APERTURE == STD_ON)
+    PORT_TEST_CHECK((Port_Sim_PeekRegister(SYSCTL_GPIOHBCTL_REG_ADDRESS) & 0x3FU) == 0x3FU);
+#else
+    PORT_TEST_CHECK(Port_Sim_GetWriteCount(SYSCTL_GPIOHBCTL_REG_ADDRESS) == 0U);
+    PORT_TEST_CHECK(Port_Sim_PeekRegister(SYSCTL_GPIOHBCTL_REG_ADDRESS) == 0U);
+#endif
+
+    /* One data register store */
+    Port_Sim_ClearCounters();
+    Dio_WriteChannel(PF1, STD_HIGH);
+    PORT_TEST_CHECK(Port_Sim_GetFaultCount() == 0U);
+#if (PORT_AHB_APERTURE == STD_ON)
+    PORT_TEST_CHECK(Port_Sim_GetBusCycleCount() == PORT_SIM_AHB_ACCESS_CYCLES);
+#else
+    PORT_TEST_CHECK(Port_Sim_GetBusCycleCount() == PORT_SIM_APB_ACCESS_CYCLES);
+#endif
+}
+
+#if ((PORT_DEV_ERROR_DETECT == STD_ON) && (PORT_SET_PIN_DIRECTION_API == STD_ON) && (PORT_SET_PIN_MODE_API == STD_ON))
+/************************************************************************************
+ * Function Name: Port_Test_PinChecks
+ * Description: The single pin services reject pins that do not exist or are not changeable before
+ *              any register access, and never touch the JTAG pins.
+ ************************************************************************************/
+STATIC void Port_Test_PinChecks(void)
+{
+    Port_Test_Start("Port single pin checks");
+    Port_Test_InitAll(&Port_PinConfigArray);
+    Port_Sim_ClearCounters();
+
+    /* The Pin IDs end at PF4 */
+    Port_SetPinDirection(PORT_NUMBER_OF_PINS, PORT_PIN_OUT);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_PARAM_PIN);
+    Port_SetPinMode(PORT_NUMBER_OF_PINS, GPIO_MODE);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_PARAM_PIN);
+
+    /* PF4 has a fixed direction and mode */
+    Port_SetPinDirection(PF4, PORT_PIN_OUT);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_DIRECTION_UNCHANGEABLE);
+    Port_SetPinMode(PF4, GPIO_MODE);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_MODE_UNCHANGEABLE);
+
+    /* PC0 is a JTAG pin */
+    Port_SetPinDirection(PC0, PORT_PIN_OUT);
+    Port_SetPinMode(PC0, GPIO_MODE);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortC, PORT_ALT_FUNC_REG_OFFSET) == 0x0FU);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortC, PORT_CTL_REG_OFFSET) == 0x00001111U);
+
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+#endif
+
+#if ((PORT_INSTRUMENTATION == STD_ON) && (PORT_SET_PIN_DIRECTION_API == STD_ON))
+/************************************************************************************
+ * Function Name: Port_Test_Instrumentation
+ * Description: Every call of an instrumented API is counted once, in its cycle histogram as well,
+ *              and the average lies between the minimum and maximum cycles.
+ ************************************************************************************/
+STATIC void Port_Test_Instrumentation(void)
+{
+    Port_InstrumentationType before;
+    Port_InstrumentationType after;
+    const Port_ApiStatisticsType *stats = &after.api[PORT_SET_PIN_DIRECTION_SID];
+    uint32 histogramCalls = 0;
+    uint8 bucket;
+
+    Port_Test_Start("Port_GetInstrumentation");
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+    Port_GetInstrumentation(&before);
+    Port_SetPinDirection(PF1, PORT_PIN_IN);
+    Port_SetPinDirection(PF1, PORT_PIN_OUT);
+    Port_SetPinDirection(PF1, PORT_PIN_IN);
+    Port_GetInstrumentation(&after);
+
+    PORT_TEST_CHECK(stats->calls == (before.api[PORT_SET_PIN_DIRECTION_SID].calls + 3U));
+    PORT_TEST_CHECK(after.api[PORT_SET_PIN_MODE_SID].calls == before.api[PORT_SET_PIN_MODE_SID].calls);
+    for (bucket = 0U; bucket < PORT_CYCLE_HISTOGRAM_BUCKETS; bucket++)
+    {
+        histogramCalls += stats->histogram[bucket];
+    }
+    PORT_TEST_CHECK(histogramCalls == stats->calls);
+    PORT_TEST_CHECK((stats->minCycles <= stats->avgCycles) && (stats->avgCycles <= stats->maxCycles));
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+#endif
+
+#if (PORT_TRACE == STD_ON)
+/************************************************************************************
+ * Function Name: Port_Test_Trace
+ * Description: The trace records every register access of the driver with the API and pin it was
+ *              made for, and replaying the trace of Port_Init from reset rebuilds the same registers.
+ ************************************************************************************/
+STATIC void Port_Test_Trace(void)
+{
+    const Port_TraceRecordType *records;
+    uint16 count;
+
+    Port_Test_Start("Port register trace");
+    Port_TraceClear();
+    Port_Test_InitAll(&Port_PinConfigArray);
+    records = Port_TraceGetRecords(&count);
+    PORT_TEST_CHECK(Port_TraceGetLostCount() == 0U);
+    PORT_TEST_CHECK(count == (Port_Sim_GetTotalReadCount() + Port_Sim_GetTotalWriteCount()));
+    PORT_TEST_CHECK((count != 0U) && (records[0].apiId == PORT_INIT_SID));
+
+    /* The replay starts from reset and checks every recorded old value on the way */
+    PORT_TEST_CHECK(Port_TraceTool_Replay(records, count) == E_OK);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0x02U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_PULL_UP_REG_OFFSET) == 0x10U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0x1FU);
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+    /* A single pin service is recorded with its pin */
+    Port_TraceClear();
+    Port_SetPinDirection(PF1, PORT_PIN_IN);
+    records = Port_TraceGetRecords(&count);
+    PORT_TEST_CHECK(count != 0U);
+    PORT_TEST_CHECK((count != 0U) && (records[count - 1U].access == PORT_TRACE_WRITE));
+    PORT_TEST_CHECK((count != 0U) && (records[count - 1U].apiId == PORT_SET_PIN_DIRECTION_SID));
+    PORT_TEST_CHECK((count != 0U) && (records[count - 1U].pin == PF1));
+#endif
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_Test_PackedConfig
+ * Description: Every field of a pin configuration is read back unchanged from its 16-bit packing.
+ ************************************************************************************/
+STATIC void Port_Test_PackedConfig(void)
+{
+    const Port_ConfigSinglePinType config =
+        PORT_PIN_CONFIG(E, 5, PORT_PIN_OUT, PULL_DOWN, PORT_PIN_LEVEL_HIGH, PE5_CAN0Tx, STD_OFF, STD_ON);
+
+    Port_Test_Start("Port packed pin configuration");
+    PORT_TEST_CHECK(sizeof(Port_ConfigSinglePinType) == 2U);
+    PORT_TEST_CHECK(PORT_CONFIG_PORT(config) == PORT_PortE);
+    PORT_TEST_CHECK(PORT_CONFIG_PIN(config) == PORT_Pin5);
+    PORT_TEST_CHECK(PORT_CONFIG_DIRECTION(config) == PORT_PIN_OUT);
+    PORT_TEST_CHECK(PORT_CONFIG_RESISTOR(config) == PULL_DOWN);
+    PORT_TEST_CHECK(PORT_CONFIG_INITIAL_VALUE(config) == PORT_PIN_LEVEL_HIGH);
+    PORT_TEST_CHECK(PORT_CONFIG_MODE(config) == PE5_CAN0Tx);
+    PORT_TEST_CHECK(PORT_CONFIG_IS_DIRECTION_CHANGEABLE(config) == STD_OFF);
+    PORT_TEST_CHECK(PORT_CONFIG_IS_MODE_CHANGEABLE(config) == STD_ON);
+
+    /* The analog mode has the largest mode value in use */
+    PORT_TEST_CHECK(PORT_CONFIG_MODE(PORT_PIN_CONFIG(B, 4, PORT_PIN_IN, OFF, PORT_PIN_LEVEL_LOW, ADC_MODE, STD_ON, STD_ON)) == ADC_MODE);
+}
+
+/************************************************************************************
+ * Function Name: Port_Test_SparseConfig
+ * Description: A configuration set lists only the pins in use, the other pins of each port get the
+ *              default configuration of their port. A pin listed twice is refused.
+ ************************************************************************************/
+STATIC void Port_Test_SparseConfig(void)
+{
+    Port_Test_Start("Port sparse configuration");
+    Port_Test_InitAll(&Port_Test_Sparse);
+    PORT_TEST_CHECK(Port_Test_Sparse.numberOfPins == 1U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_DIR_REG_OFFSET) == 0x04U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_DATA_REG_OFFSET) == 0x04U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_PULL_UP_REG_OFFSET) == 0xFBU);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortB, PORT_DIGITAL_ENABLE_REG_OFFSET) == 0xFFU);
+
+#if (PORT_DEV_ERROR_DETECT == STD_ON)
+    Port_Test_Start("Port configuration with a pin listed twice");
+    Port_Init(&Port_Test_Twice);
+    PORT_TEST_CHECK(Port_Test_TakeError() == PORT_E_INIT_FAILED);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+#endif
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+
+/************************************************************************************
+ * Function Name: Port_Test_RefreshPortDirection
+ * Description: Port_RefreshPortDirection only accesses the ports that have pins with a fixed
+ *              direction, and restores their direction bits.
+ ************************************************************************************/
+STATIC void Port_Test_RefreshPortDirection(void)
+{
+    Port_Test_Start("Port_RefreshPortDirection");
+
+    /* Every pin of the sparse configuration has a changeable direction */
+    Port_Test_InitAll(&Port_Test_Sparse);
+    Port_Sim_ClearCounters();
+    Port_RefreshPortDirection();
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+
+    /* Only port F has a fixed pin in the shipped configuration */
+    Port_Test_InitAll(&Port_PinConfigArray);
+    Port_Sim_WriteRegister(Port_Test_BaseAddress[PORT_PortF] + PORT_DIR_REG_OFFSET, 0x12U);
+    Port_Sim_ClearCounters();
+    Port_RefreshPortDirection();
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_DIR_REG_OFFSET) == 0x02U);
+    PORT_TEST_CHECK(Port_Sim_GetReadCount(Port_Test_BaseAddress[PORT_PortF] + PORT_DIR_REG_OFFSET) == 1U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalReadCount() == 1U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 1U);
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+/************************************************************************************
+ * Function Name: Port_Test_PinDescriptors
+ * Description: Every Pin ID reaches the direction bit of its own port and pin with one write.
+ ************************************************************************************/
+STATIC void Port_Test_PinDescriptors(void)
+{
+    const Port_PinType firstPin[PORT_NUMBER_OF_PORTS] = {PA0, PB0, PC0, PD0, PE0, PF0};
+    const uint8 pinCount[PORT_NUMBER_OF_PORTS] = {8U, 8U, 8U, 8U, 6U, 5U};
+    uint8 port;
+    uint8 pin;
+
+    Port_Test_Start("Port pin descriptors");
+    Port_Test_InitAll(&Port_PinConfigArray);
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        for (pin = 0U; pin < pinCount[port]; pin++)
+        {
+            Port_PinType id = (Port_PinType)(firstPin[port] + pin);
+            uint32 before = PORT_TEST_REG(port, PORT_DIR_REG_OFFSET);
+
+            /* The JTAG pins and the fixed PF4 are not changed */
+            if (((port == PORT_PortC) && (pin < 4U)) || (id == PF4))
+            {
+                continue;
+            }
+            else
+            {
+                /* Do Nothing */
+            }
+
+            Port_Sim_ClearCounters();
+            Port_SetPinDirection(id, PORT_PIN_OUT);
+            PORT_TEST_CHECK(PORT_TEST_REG(port, PORT_DIR_REG_OFFSET) == (before | (1U << pin)));
+            PORT_TEST_CHECK(PORT_TEST_WRITES(port, PORT_DIR_REG_OFFSET) == 1U);
+            PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 1U);
+        }
+    }
+    PORT_TEST_CHECK(Port_Test_TakeError() == 0U);
+}
+#endif
+
+/************************************************************************************
+ * Function Name: Port_Test_Simulator
+ * Description: The simulated register file faults the accesses to gated ports and keeps the
+ *              uncommitted bits of the protected registers, as the target does.
+ ************************************************************************************/
+STATIC void Port_Test_Simulator(void)
+{
+    const uint32 portA = Port_Test_BaseAddress[PORT_PortA];
+    const uint32 portF = Port_Test_BaseAddress[PORT_PortF];
+
+    Port_Test_Start("Port simulated register file");
+
+    /* Port A is gated after reset */
+    Port_Sim_WriteRegister(portA + PORT_DIR_REG_OFFSET, 0x01U);
+    PORT_TEST_CHECK(Port_Sim_GetFaultCount() == 1U);
+    PORT_TEST_CHECK(Port_Sim_GetTotalWriteCount() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetLoggedWrite(0U) == 0U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortA, PORT_DIR_REG_OFFSET) == 0U);
+
+    Port_Sim_WriteRegister(SYSCTL_RCGCGPIO_REG_ADDRESS, 0x3FU);
+#if (PORT_AHB_APERTURE == STD_ON)
+    Port_Sim_WriteRegister(SYSCTL_GPIOHBCTL_REG_ADDRESS, 0x3FU);
+#endif
+    Port_Sim_ClearCounters();
+    Port_Sim_WriteRegister(portA + PORT_DIR_REG_OFFSET, 0x01U);
+    PORT_TEST_CHECK(Port_Sim_GetFaultCount() == 0U);
+    PORT_TEST_CHECK(Port_Sim_GetLoggedWrite(0U) == (portA + PORT_DIR_REG_OFFSET));
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortA, PORT_DIR_REG_OFFSET) == 0x01U);
+
+    /* PF0 is not committed until port F is unlocked */
+    Port_Sim_WriteRegister(portF + PORT_ALT_FUNC_REG_OFFSET, 0x03U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_ALT_FUNC_REG_OFFSET) == 0x02U);
+    Port_Sim_WriteRegister(portF + PORT_COMMIT_REG_OFFSET, 0xFFU);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_COMMIT_REG_OFFSET) == 0xFEU);
+    Port_Sim_WriteRegister(portF + PORT_LOCK_REG_OFFSET, PORT_UNLOCK_VALUE);
+    Port_Sim_WriteRegister(portF + PORT_COMMIT_REG_OFFSET, 0xFFU);
+    Port_Sim_WriteRegister(portF + PORT_ALT_FUNC_REG_OFFSET, 0x03U);
+    PORT_TEST_CHECK(PORT_TEST_REG(PORT_PortF, PORT_ALT_FUNC_REG_OFFSET) == 0x03U);
+}
+
+int main(void)
+{
+    Port_Test_Init();
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+    Port_Test_SetPortPinsDirection();
+#endif
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+    Port_Test_SetPortPinsMode();
+#endif
+#if (PORT_REFRESH_DRIFT_DETECTION == STD_ON)
+    Port_Test_RefreshDrift();
+#endif
+    Port_Test_ClockGating();
+#if (PORT_INIT_PORT_API == STD_ON)
+    Port_Test_InitPort();
+#endif
+#if (PORT_SWITCH_CONFIGURATION_API == STD_ON)
+    Port_Test_SwitchConfiguration();
+#endif
+    Port_Test_Dio();
+#if (PORT_SET_PIN_MODE_API == STD_ON)
+    Port_Test_PinModes();
+#endif
+    Port_Test_Det();
+#if (PORT_INIT_IMAGE_API == STD_ON)
+    Port_Test_InitImage();
+#endif
+#if ((PORT_UPDATE_TRANSACTION_API == STD_ON) && (PORT_SET_PIN_DIRECTION_API == STD_ON) && (PORT_SET_PIN_MODE_API == STD_ON))
+    Port_Test_Update();
+#endif
+#if ((PORT_SHADOW_REGISTERS == STD_ON) && (PORT_SET_PIN_DIRECTION_API == STD_ON) && (PORT_SET_PIN_MODE_API == STD_ON))
+    Port_Test_ShadowRegisters();
+#endif
+#if (PORT_VERIFY_CONFIGURATION_API == STD_ON)
+    Port_Test_VerifyConfiguration();
+#endif
+#if (PORT_SNAPSHOT_API == STD_ON)
+    Port_Test_Snapshot();
+#endif
+#if ((PORT_BIT_BAND_ACCESS == STD_ON) && (PORT_SHADOW_REGISTERS == STD_OFF) && (PORT_SET_PIN_DIRECTION_API == STD_ON))
+    Port_Test_BitBand();
+#endif
+    Port_Test_Aperture();
+#if ((PORT_DEV_ERROR_DETECT == STD_ON) && (PORT_SET_PIN_DIRECTION_API == STD_ON) && (PORT_SET_PIN_MODE_API == STD_ON))
+    Port_Test_PinChecks();
+#endif
+#if ((PORT_INSTRUMENTATION == STD_ON) && (PORT_SET_PIN_DIRECTION_API == STD_ON))
+    Port_Test_Instrumentation();
+#endif
+#if (PORT_TRACE == STD_ON)
+    Port_Test_Trace();
+#endif
+    Port_Test_PackedConfig();
+    Port_Test_SparseConfig();
+    Port_Test_RefreshPortDirection();
+#if (PORT_SET_PIN_DIRECTION_API == STD_ON)
+    Port_Test_PinDescriptors();
+#endif
+    Port_Test_Simulator();
+
+    printf("%u checks, %u failed\n", (unsigned)Port_Test_Checks, (unsigned)Port_Test_Failures);
+    return (Port_Test_Failures == 0U) ? 0 : 1;
+}
+
+#endif /* PORT_HOST_BACKEND == STD_ON */
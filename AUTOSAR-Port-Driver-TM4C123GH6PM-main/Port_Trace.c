@@ -0,0 +1,344 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Trace.c
+ *
+ * Description: Register access trace of the Port Driver. With PORT_TRACE every access of Port.c goes through
+ *              Port_TraceRead/Port_TraceWrite, which record the address, the old and new register values and
+ *              the API and pin that made the access. Host builds also get the decode, diff and replay tool.
+ *
+ * Author: Ammar Moataz
+ ******************************************************************************/
+
+#include "Port_Trace.h"
+#include "Port_Regs.h"
+
+#if (PORT_TRACE == STD_ON)
+
+/* Recorded accesses */
+STATIC Port_TraceRecordType Port_TraceBuffer[PORT_TRACE_BUFFER_SIZE];
+STATIC uint16 Port_TraceCount = 0;
+STATIC uint16 Port_TraceLostCount = 0;
+
+/* API and pin of the accesses being recorded */
+STATIC uint8 Port_TraceApiId = 0;
+STATIC uint8 Port_TracePin = PORT_TRACE_NO_PIN;
+
+/************************************************************************************
+ * Function Name: Port_TraceRecord
+ * Parameters (in): Address - Register address, OldValue, NewValue - Register value before and after the access,
+ *                  Access - PORT_TRACE_READ or PORT_TRACE_WRITE
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Appends one record to the trace buffer, or counts it as lost when the buffer is full.
+ ************************************************************************************/
+STATIC void Port_TraceRecord(uint32 Address, uint32 OldValue, uint32 NewValue, uint8 Access)
+{
+    if (Port_TraceCount < PORT_TRACE_BUFFER_SIZE)
+    {
+        Port_TraceRecordType *record = &Port_TraceBuffer[Port_TraceCount];
+
+        record->address = Address;
+        record->oldValue = OldValue;
+        record->newValue = NewValue;
+        record->apiId = Port_TraceApiId;
+        record->pin = Port_TracePin;
+        record->access = Access;
+        record->reserved = 0;
+        Port_TraceCount++;
+    }
+    else if (Port_TraceLostCount < 0xFFFFU)
+    {
+        Port_TraceLostCount++;
+    }
+    else
+    {
+        /* Do Nothing */
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_TraceSetContext
+ * Parameters (in): ApiId - Service ID of the running API, Pin - Pin ID or PORT_TRACE_NO_PIN
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Sets the API and pin the following accesses are recorded for.
+ ************************************************************************************/
+void Port_TraceSetContext(uint8 ApiId, uint8 Pin)
+{
+    Port_TraceApiId = ApiId;
+    Port_TracePin = Pin;
+}
+
+/************************************************************************************
+ * Function Name: Port_TraceRead
+ * Parameters (in): Address - Register address
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Register value
+ * Description: Reads a register and records the access.
+ ************************************************************************************/
+uint32 Port_TraceRead(uint32 Address)
+{
+    uint32 value = PORT_RAW_READ_REG(Address);
+
+    Port_TraceRecord(Address, value, value, PORT_TRACE_READ);
+    return value;
+}
+
+/************************************************************************************
+ * Function Name: Port_TraceWrite
+ * Parameters (in): Address - Register address, Value - New register value
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Writes a register and records the access with the register value before it and the
+ *              written value. On target the old value is read from the register, on host builds it is
+ *              peeked from the simulated register file without counting the access.
+ ************************************************************************************/
+void Port_TraceWrite(uint32 Address, uint32 Value)
+{
+    uint32 oldValue = PORT_PEEK_REG(Address);
+
+    PORT_RAW_WRITE_REG(Address, Value);
+    Port_TraceRecord(Address, oldValue, Value, PORT_TRACE_WRITE);
+}
+
+/************************************************************************************
+ * Function Name: Port_TraceGetRecords
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): Count - Number of records in the trace buffer
+ * Return value: The trace buffer
+ * Description: Returns the recorded accesses, oldest first.
+ ************************************************************************************/
+const Port_TraceRecordType *Port_TraceGetRecords(uint16 *Count)
+{
+    *Count = Port_TraceCount;
+    return Port_TraceBuffer;
+}
+
+/************************************************************************************
+ * Function Name: Port_TraceGetLostCount
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Number of lost accesses
+ * Description: Returns the number of accesses not recorded because the trace buffer was full.
+ ************************************************************************************/
+uint16 Port_TraceGetLostCount(void)
+{
+    return Port_TraceLostCount;
+}
+
+/************************************************************************************
+ * Function Name: Port_TraceClear
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Empties the trace buffer and clears the lost count.
+ ************************************************************************************/
+void Port_TraceClear(void)
+{
+    Port_TraceCount = 0;
+    Port_TraceLostCount = 0;
+}
+
+#endif /* PORT_TRACE == STD_ON */
+
+#if (PORT_HOST_BACKEND == STD_ON)
+
+#include "Port_Sim.h"
+
+/* Registers compared by Port_TraceTool_Diff on every port */
+STATIC const uint32 Port_TraceTool_PortRegisters[] = {
+    PORT_DATA_REG_OFFSET,
+    PORT_DIR_REG_OFFSET,
+    PORT_ALT_FUNC_REG_OFFSET,
+    PORT_PULL_UP_REG_OFFSET,
+    PORT_PULL_DOWN_REG_OFFSET,
+    PORT_DIGITAL_ENABLE_REG_OFFSET,
+    PORT_COMMIT_REG_OFFSET,
+    PORT_ANALOG_MODE_SEL_REG_OFFSET,
+    PORT_CTL_REG_OFFSET};
+
+/* System Control registers compared by Port_TraceTool_Diff */
+STATIC const uint32 Port_TraceTool_SysctlRegisters[] = {
+    SYSCTL_RCGC2_REG_ADDRESS,
+    SYSCTL_RCGCGPIO_REG_ADDRESS,
+    SYSCTL_GPIOHBCTL_REG_ADDRESS};
+
+/* GPIO Registers APB base address of each port, the diff reads both apertures through it */
+STATIC const uint32 Port_TraceTool_BaseAddress[PORT_NUMBER_OF_PORTS] = {
+    GPIO_PORTA_APB_BASE_ADDRESS,
+    GPIO_PORTB_APB_BASE_ADDRESS,
+    GPIO_PORTC_APB_BASE_ADDRESS,
+    GPIO_PORTD_APB_BASE_ADDRESS,
+    GPIO_PORTE_APB_BASE_ADDRESS,
+    GPIO_PORTF_APB_BASE_ADDRESS};
+
+/* Number of registers compared by Port_TraceTool_Diff */
+#define PORT_TRACE_TOOL_PORT_REGISTERS    (sizeof(Port_TraceTool_PortRegisters) / sizeof(Port_TraceTool_PortRegisters[0]))
+#define PORT_TRACE_TOOL_SYSCTL_REGISTERS  (sizeof(Port_TraceTool_SysctlRegisters) / sizeof(Port_TraceTool_SysctlRegisters[0]))
+#define PORT_TRACE_TOOL_REGISTERS         ((PORT_NUMBER_OF_PORTS * PORT_TRACE_TOOL_PORT_REGISTERS) + PORT_TRACE_TOOL_SYSCTL_REGISTERS)
+
+/************************************************************************************
+ * Function Name: Port_TraceTool_Decode
+ * Parameters (in): Records - Trace records, Count - Number of records, Stream - Output stream
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: None
+ * Description: Prints one line per record: index, access kind, service ID, Pin ID, address,
+ *              old and new value and the bits changed by writes.
+ ************************************************************************************/
+void Port_TraceTool_Decode(const Port_TraceRecordType *Records, uint16 Count, FILE *Stream)
+{
+    uint16 index;
+
+    for (index = 0; index < Count; index++)
+    {
+        const Port_TraceRecordType *record = &Records[index];
+
+        (void)fprintf(Stream, "%5u %s sid=0x%02X pin=", (unsigned int)index,
+                      (record->access == PORT_TRACE_WRITE) ? "W" : "R", (unsigned int)record->apiId);
+        if (record->pin == PORT_TRACE_NO_PIN)
+        {
+            (void)fprintf(Stream, "--");
+        }
+        else
+        {
+            (void)fprintf(Stream, "%2u", (unsigned int)record->pin);
+        }
+        (void)fprintf(Stream, " 0x%08X 0x%08X -> 0x%08X changed=0x%08X\n", (unsigned int)record->address,
+                      (unsigned int)record->oldValue, (unsigned int)record->newValue,
+                      (unsigned int)(record->oldValue ^ record->newValue));
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_TraceTool_Replay
+ * Parameters (in): Records - Trace records, Count - Number of records
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: E_OK if the simulated registers matched the recorded values at every access
+ * Description: Resets the simulated register file and repeats the accesses of a trace on it.
+ *              The register value before each access is compared with the recorded one.
+ ************************************************************************************/
+Std_ReturnType Port_TraceTool_Replay(const Port_TraceRecordType *Records, uint16 Count)
+{
+    Std_ReturnType result = E_OK;
+    uint16 index;
+
+    Port_Sim_Reset();
+    for (index = 0; index < Count; index++)
+    {
+        const Port_TraceRecordType *record = &Records[index];
+
+        if (Port_Sim_PeekRegister(record->address) != record->oldValue)
+        {
+            result = E_NOT_OK;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+
+        if (record->access == PORT_TRACE_WRITE)
+        {
+            Port_Sim_WriteRegister(record->address, record->newValue);
+        }
+        else
+        {
+            (void)Port_Sim_ReadRegister(record->address);
+        }
+    }
+
+    return result;
+}
+
+/************************************************************************************
+ * Function Name: Port_TraceTool_Capture
+ * Parameters (in): None
+ * Parameters (inout): None
+ * Parameters (out): Values - Values of the compared registers
+ * Return value: None
+ * Description: Peeks the registers compared by Port_TraceTool_Diff from the simulated register file.
+ ************************************************************************************/
+STATIC void Port_TraceTool_Capture(uint32 *Values)
+{
+    uint8 port;
+    uint8 reg;
+    uint16 index = 0;
+
+    for (port = PORT_PortA; port < PORT_NUMBER_OF_PORTS; port++)
+    {
+        for (reg = 0; reg < PORT_TRACE_TOOL_PORT_REGISTERS; reg++)
+        {
+            Values[index++] = Port_Sim_PeekRegister(Port_TraceTool_BaseAddress[port] + Port_TraceTool_PortRegisters[reg]);
+        }
+    }
+    for (reg = 0; reg < PORT_TRACE_TOOL_SYSCTL_REGISTERS; reg++)
+    {
+        Values[index++] = Port_Sim_PeekRegister(Port_TraceTool_SysctlRegisters[reg]);
+    }
+}
+
+/************************************************************************************
+ * Function Name: Port_TraceTool_Diff
+ * Parameters (in): RecordsA, CountA - First trace, RecordsB, CountB - Second trace, Stream - Output stream
+ * Parameters (inout): None
+ * Parameters (out): None
+ * Return value: Number of registers whose final values differ
+ * Description: Replays both traces from reset and compares the final GPIO configuration and data
+ *              registers of every port and the clock gating and aperture registers. Prints each
+ *              differing register and the reads and writes of both traces, so an optimized
+ *              sequence can be shown to reach the same state with fewer accesses.
+ ************************************************************************************/
+uint16 Port_TraceTool_Diff(const Port_TraceRecordType *RecordsA, uint16 CountA,
+                           const Port_TraceRecordType *RecordsB, uint16 CountB, FILE *Stream)
+{
+    uint32 valuesA[PORT_TRACE_TOOL_REGISTERS];
+    uint32 valuesB[PORT_TRACE_TOOL_REGISTERS];
+    uint32 readsA;
+    uint32 writesA;
+    uint16 differences = 0;
+    uint16 index;
+
+    (void)Port_TraceTool_Replay(RecordsA, CountA);
+    Port_TraceTool_Capture(valuesA);
+    readsA = Port_Sim_GetTotalReadCount();
+    writesA = Port_Sim_GetTotalWriteCount();
+
+    (void)Port_TraceTool_Replay(RecordsB, CountB);
+    Port_TraceTool_Capture(valuesB);
+
+    for (index = 0; index < PORT_TRACE_TOOL_REGISTERS; index++)
+    {
+        if (valuesA[index] != valuesB[index])
+        {
+            uint32 address = (index < (PORT_NUMBER_OF_PORTS * PORT_TRACE_TOOL_PORT_REGISTERS))
+                                 ? (Port_TraceTool_BaseAddress[index / PORT_TRACE_TOOL_PORT_REGISTERS] + Port_TraceTool_PortRegisters[index % PORT_TRACE_TOOL_PORT_REGISTERS])
+                                 : Port_TraceTool_SysctlRegisters[index - (PORT_NUMBER_OF_PORTS * PORT_TRACE_TOOL_PORT_REGISTERS)];
+
+            (void)fprintf(Stream, "0x%08X A=0x%08X B=0x%08X\n", (unsigned int)address,
+                          (unsigned int)valuesA[index], (unsigned int)valuesB[index]);
+            differences++;
+        }
+        else
+        {
+            /* Do Nothing */
+        }
+    }
+
+    (void)fprintf(Stream, "A: %u reads %u writes, B: %u reads %u writes, %u registers differ\n",
+                  (unsigned int)readsA, (unsigned int)writesA, (unsigned int)Port_Sim_GetTotalReadCount(),
+                  (unsigned int)Port_Sim_GetTotalWriteCount(), (unsigned int)differences);
+
+    return differences;
+}
+
+#endif /* PORT_HOST_BACKEND == STD_ON */
@@ -0,0 +1,106 @@
+/******************************************************************************
+ *
+ * Module: Port
+ *
+ * File Name: Port_Trace.h
+ *
+ * Description: Header file for the register access trace of the Port Driver and its host decode, diff and replay tool.
+ *
+ * Author: Ammar Moataz
+ ******************************************************************************/
+
+#ifndef PORT_TRACE_H
+#define PORT_TRACE_H
+
+/* Standard AUTOSAR types */
+#include "Std_Types.h"
+
+/* Port Pre-Compile Configuration Header file */
+#include "Port_Cfg.h"
+
+/*******************************************************************************
+ *                              Module Definitions                             *
+ *******************************************************************************/
+
+/* Number of records of the trace buffer */
+#ifndef PORT_TRACE_BUFFER_SIZE
+#define PORT_TRACE_BUFFER_SIZE            (256U)
+#endif
+
+/* Kind of a traced access */
+#define PORT_TRACE_READ                   (0U)
+#define PORT_TRACE_WRITE                  (1U)
+
+/* Pin ID recorded for the APIs that do not work on a single pin */
+#define PORT_TRACE_NO_PIN                 (0xFFU)
+
+/* Sets the API and pin the following accesses are recorded for */
+#if (PORT_TRACE == STD_ON)
+#define PORT_TRACE_CONTEXT(SID, PIN)      Port_TraceSetContext((SID), (PIN))
+#else
+#define PORT_TRACE_CONTEXT(SID, PIN)
+#endif
+
+/*******************************************************************************
+ *                              Module Data Types                              *
+ *******************************************************************************/
+
+/* Description: One register access, 16 bytes per record.
+ *	1. The accessed register address.
+ *	2. The register value before the access and the written value, equal for reads.
+ *	3. The service ID of the API and the Pin ID it was called for.
+ *	4. PORT_TRACE_READ or PORT_TRACE_WRITE.
+ */
+typedef struct
+{
+  uint32 address;
+  uint32 oldValue;
+  uint32 newValue;
+  uint8 apiId;
+  uint8 pin;
+  uint8 access;
+  uint8 reserved;
+} Port_TraceRecordType;
+
+/*******************************************************************************
+ *                      Function Prototypes                                    *
+ *******************************************************************************/
+#if (PORT_TRACE == STD_ON)
+
+/* Sets the API and pin the following accesses are recorded for */
+void Port_TraceSetContext(uint8 ApiId, uint8 Pin);
+
+/* Reads a register and records the access */
+uint32 Port_TraceRead(uint32 Address);
+
+/* Writes a register and records the access with the previous register value */
+void Port_TraceWrite(uint32 Address, uint32 Value);
+
+/* Returns the trace buffer and the number of records in it */
+const Port_TraceRecordType *Port_TraceGetRecords(uint16 *Count);
+
+/* Returns the number of accesses not recorded because the trace buffer was full */
+uint16 Port_TraceGetLostCount(void);
+
+/* Empties the trace buffer */
+void Port_TraceClear(void);
+
+#endif
+
+#if (PORT_HOST_BACKEND == STD_ON)
+
+#include <stdio.h>
+
+/* Prints one line per record of a trace */
+void Port_TraceTool_Decode(const Port_TraceRecordType *Records, uint16 Count, FILE *Stream);
+
+/* Replays the writes and reads of a trace on the simulated register file from its reset state */
+Std_ReturnType Port_TraceTool_Replay(const Port_TraceRecordType *Records, uint16 Count);
+
+/* Replays two traces and prints the registers whose final values differ and the access counts of both */
+uint16 Port_TraceTool_Diff(const Port_TraceRecordType *RecordsA, uint16 CountA,
+                           const Port_TraceRecordType *RecordsB, uint16 CountB, FILE *Stream);
+
+#endif
+
+#endif /* PORT_TRACE_H */